@@ -0,0 +1,130 @@
+// File: CPUTopology.h
+// Socket / NUMA node / last-level cache / SMT description of a machine and
+// the cost of moving a task between two of its logical CPUs
+
+#ifndef CPU_TOPOLOGY_H
+#define CPU_TOPOLOGY_H
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <algorithm>
+
+// Logical CPUs are numbered depth-first: socket, NUMA node, LLC domain,
+// physical core, SMT thread. The distance between two CPUs is the innermost
+// level they share, and every level has a migration cost - the time a moved
+// task spends refilling caches or fetching memory from a remote node.
+class CPUTopology {
+public:
+    enum Distance {
+        SAME_CPU = 0,
+        SMT_SIBLING,     // same physical core, L1/L2 shared
+        SHARED_LLC,      // same last-level cache
+        SAME_NODE,       // same NUMA node, different LLC
+        SAME_SOCKET,     // same package, remote NUMA node
+        REMOTE_SOCKET,   // across the socket interconnect
+        DISTANCE_LEVELS
+    };
+
+    struct CPU {
+        int socket;
+        int numa_node;
+        int llc;
+        int physical_core;
+    };
+
+    // Milliseconds charged to a task migrated across each distance level
+    std::array<int, DISTANCE_LEVELS> migration_cost_ms = {0, 0, 1, 3, 5, 8};
+
+    static CPUTopology build(int sockets, int nodes_per_socket, int llcs_per_node,
+                             int cores_per_llc, int threads_per_core) {
+        CPUTopology topology;
+        int node = 0, llc = 0, core = 0;
+        for (int s = 0; s < sockets; s++) {
+            for (int n = 0; n < nodes_per_socket; n++, node++) {
+                for (int l = 0; l < llcs_per_node; l++, llc++) {
+                    for (int c = 0; c < cores_per_llc; c++, core++) {
+                        for (int t = 0; t < threads_per_core; t++) {
+                            topology.cpus.push_back({s, node, llc, core});
+                        }
+                    }
+                }
+            }
+        }
+        topology.precompute();
+        return topology;
+    }
+
+    // Every CPU equidistant: one socket, one node, one shared cache
+    static CPUTopology flat(int cpu_count) {
+        return build(1, 1, 1, cpu_count, 1);
+    }
+
+    int size() const { return static_cast<int>(cpus.size()); }
+    const CPU& cpu(int id) const { return cpus[id]; }
+
+    Distance distance(int from, int to) const {
+        return static_cast<Distance>(distances[from * size() + to]);
+    }
+
+    int migrationCost(int from, int to) const {
+        return migration_cost_ms[distance(from, to)];
+    }
+
+    // Other CPUs ordered nearest first (ties by id) - the steal order
+    const std::vector<int>& nearestFirst(int id) const {
+        return neighbours[id];
+    }
+
+    static const char* distanceName(int level) {
+        static const char* names[DISTANCE_LEVELS] = {
+            "same CPU", "SMT sibling", "shared LLC", "same node", "same socket", "remote socket"
+        };
+        return names[level];
+    }
+
+    void display() const {
+        std::cout << "\n=== CPU TOPOLOGY ===\n";
+        for (int i = 0; i < size(); i++) {
+            std::cout << "CPU " << i << ": Socket " << cpus[i].socket
+                      << ", NUMA Node " << cpus[i].numa_node
+                      << ", LLC " << cpus[i].llc
+                      << ", Core " << cpus[i].physical_core << "\n";
+        }
+        std::cout << "Migration cost (ms):";
+        for (int level = SMT_SIBLING; level < DISTANCE_LEVELS; level++) {
+            std::cout << " " << distanceName(level) << "=" << migration_cost_ms[level]
+                      << (level + 1 < DISTANCE_LEVELS ? "," : "\n");
+        }
+    }
+
+private:
+    std::vector<CPU> cpus;
+    std::vector<unsigned char> distances;     // size() x size() matrix
+    std::vector<std::vector<int>> neighbours;
+
+    void precompute() {
+        const int n = size();
+        distances.assign(n * n, SAME_CPU);
+        neighbours.assign(n, std::vector<int>());
+        for (int a = 0; a < n; a++) {
+            for (int b = 0; b < n; b++) {
+                Distance d;
+                if (a == b) d = SAME_CPU;
+                else if (cpus[a].physical_core == cpus[b].physical_core) d = SMT_SIBLING;
+                else if (cpus[a].llc == cpus[b].llc) d = SHARED_LLC;
+                else if (cpus[a].numa_node == cpus[b].numa_node) d = SAME_NODE;
+                else if (cpus[a].socket == cpus[b].socket) d = SAME_SOCKET;
+                else d = REMOTE_SOCKET;
+                distances[a * n + b] = static_cast<unsigned char>(d);
+                if (a != b) neighbours[a].push_back(b);
+            }
+            std::stable_sort(neighbours[a].begin(), neighbours[a].end(),
+                             [this, a, n](int x, int y) {
+                                 return distances[a * n + x] < distances[a * n + y];
+                             });
+        }
+    }
+};
+
+#endif // CPU_TOPOLOGY_H
@@ -0,0 +1,79 @@
+// File: EnergyModel.h
+// Per-core P-states, a DVFS governor and energy accounting for the
+// virtual-time multiprocessor simulation
+
+#ifndef ENERGY_MODEL_H
+#define ENERGY_MODEL_H
+
+#include <vector>
+#include <algorithm>
+
+// Burst times are given at the top P-state; a task run at a lower frequency
+// takes proportionally longer. Power is per core: active_watts while running
+// at a P-state, idle_watts in the idle state between tasks.
+struct PState {
+    int mhz;
+    double active_watts;
+};
+
+class EnergyModel {
+public:
+    enum Governor {
+        RACE_TO_IDLE, // always the top P-state, finish fast and idle
+        SPREAD        // lowest P-state the backlog allows: slow while the queue is short
+    };
+
+    // Rough laptop-class core: power grows with V^2 * f, so energy per
+    // unit of work rises with frequency while idle power stays small
+    std::vector<PState> pstates = {
+        {1000, 2.0}, {1600, 3.6}, {2200, 6.2}, {3000, 11.5}
+    };
+    double idle_watts = 0.5;
+    Governor governor = RACE_TO_IDLE;
+
+    int topState() const { return static_cast<int>(pstates.size()) - 1; }
+
+    // P-state for a dispatch given how many tasks are still queued behind it.
+    // SPREAD steps up one state per queued task, so a backlog is still
+    // drained at full speed.
+    int choose(int queued_behind) const {
+        if (governor == RACE_TO_IDLE) return topState();
+        return std::min(topState(), std::max(queued_behind, 0));
+    }
+
+    // Wall time of work_ms (measured at the top P-state) run at pstate
+    long long runTime(long long work_ms, int pstate) const {
+        long long top = pstates[topState()].mhz;
+        long long mhz = pstates[pstate].mhz;
+        return (work_ms * top + mhz - 1) / mhz;
+    }
+
+    static const char* governorName(Governor g) {
+        return g == RACE_TO_IDLE ? "race-to-idle" : "spread";
+    }
+};
+
+// Energy of one core over a run
+struct CoreEnergy {
+    long long busy_ms = 0;
+    double active_joules = 0.0;
+    std::vector<long long> pstate_ms; // residency per P-state
+};
+
+// Whole-run energy summary; idle energy covers every core up to the makespan
+struct EnergyReport {
+    long long makespan_ms = 0;
+    long long tasks = 0;
+    double active_joules = 0.0;
+    double idle_joules = 0.0;
+    std::vector<long long> pstate_ms;
+
+    double joules() const { return active_joules + idle_joules; }
+    double averageWatts() const { return makespan_ms > 0 ? joules() * 1000.0 / makespan_ms : 0.0; }
+    double throughput() const { return makespan_ms > 0 ? tasks * 1000.0 / makespan_ms : 0.0; }
+    double joulesPerTask() const { return tasks > 0 ? joules() / tasks : 0.0; }
+    // Throughput per watt reduces to tasks per joule
+    double tasksPerJoule() const { return joules() > 0 ? tasks / joules() : 0.0; }
+};
+
+#endif // ENERGY_MODEL_H
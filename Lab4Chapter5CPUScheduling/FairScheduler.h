@@ -0,0 +1,210 @@
+// File: FairScheduler.h
+// Completely-Fair-Scheduler style virtual-runtime scheduler
+
+#ifndef FAIR_SCHEDULER_H
+#define FAIR_SCHEDULER_H
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <iomanip>
+#include <utility>
+#include <chrono>
+
+#include "ProcessTable.h"
+
+struct CFSConfig {
+    int target_latency = 20;      // period in which every runnable task should run once
+    int min_granularity = 2;      // shortest slice, stretches the period when crowded
+    int wakeup_granularity = 2;   // vruntime lead a new arrival needs to preempt
+};
+
+// Each task accumulates vruntime = CPU time * NICE_0_WEIGHT / weight, and the
+// task with the smallest vruntime runs next. Runnable tasks live on a timeline
+// ordered by (vruntime, index) - std::set is a red-black tree - so pick-next
+// and re-insert are O(log n). The running task is kept off the timeline, as
+// in Linux. A process's priority field is used as its nice value (-20..19).
+class CFSScheduler {
+public:
+    struct Stats {
+        long long decisions = 0;      // pick-next operations
+        long long preemptions = 0;    // wakeup preemptions by new arrivals
+        double scheduler_seconds = 0; // wall time spent in schedule()
+        double fairness = 0;          // Jain's index over weighted service rates
+    };
+
+    static constexpr int NICE_0_WEIGHT = 1024;
+
+    explicit CFSScheduler(CFSConfig cfg = CFSConfig()) : config(cfg) {
+        config.target_latency = std::max(config.target_latency, 1);
+        config.min_granularity = std::max(config.min_granularity, 1);
+        config.wakeup_granularity = std::max(config.wakeup_granularity, 0);
+    }
+
+    // Load weight of a nice value, from the Linux sched_prio_to_weight table
+    static int weightOf(int nice) {
+        static const int prio_to_weight[40] = {
+            88761, 71755, 56483, 46273, 36291,
+            29154, 23254, 18705, 14949, 11916,
+             9548,  7620,  6100,  4904,  3906,
+             3121,  2501,  1991,  1586,  1277,
+             1024,   820,   655,   526,   423,
+              335,   272,   215,   172,   137,
+              110,    87,    70,    56,    45,
+               36,    29,    23,    18,    15,
+        };
+        return prio_to_weight[std::min(std::max(nice, -20), 19) + 20];
+    }
+
+    // Jain's fairness index over burst/turnaround normalized by weight:
+    // 1.0 means every task progressed exactly in proportion to its weight
+    static double fairnessIndex(const std::vector<Process>& processes) {
+        double sum = 0.0;
+        double sum_squares = 0.0;
+        int count = 0;
+        for (const auto& p : processes) {
+            if (p.turnaround_time <= 0) continue;
+            double rate = static_cast<double>(p.burst_time) / p.turnaround_time
+                          * NICE_0_WEIGHT / weightOf(p.priority);
+            sum += rate;
+            sum_squares += rate * rate;
+            count++;
+        }
+        if (count == 0 || sum_squares == 0.0) return 1.0;
+        return (sum * sum) / (count * sum_squares);
+    }
+
+    // Schedules processes and fills in completion, turnaround and waiting times
+    Stats schedule(std::vector<Process>& processes) {
+        auto wall_start = std::chrono::steady_clock::now();
+
+        const int n = processes.size();
+        Stats stats;
+
+        std::vector<int> remaining_time(n);
+        std::vector<int> weight(n);
+        std::vector<double> vruntime(n, 0.0);
+        std::vector<int> arrival_order(n);
+
+        for (int i = 0; i < n; i++) {
+            remaining_time[i] = processes[i].burst_time;
+            weight[i] = weightOf(processes[i].priority);
+            arrival_order[i] = i;
+        }
+        std::stable_sort(arrival_order.begin(), arrival_order.end(),
+                         [&processes](int a, int b) {
+                             return processes[a].arrival_time < processes[b].arrival_time;
+                         });
+
+        std::set<std::pair<double, int>> timeline;
+        long long total_weight = 0; // runnable weight, including the running task
+        double min_vruntime = 0.0;
+
+        int current_time = 0;
+        int completed = 0;
+        int next_arrival = 0; // cursor into arrival_order
+        int running = -1;
+        int slice_left = 0;
+
+        auto admit_arrivals = [&]() {
+            while (next_arrival < n &&
+                   processes[arrival_order[next_arrival]].arrival_time <= current_time) {
+                int idx = arrival_order[next_arrival++];
+                // New tasks start at min_vruntime so they cannot monopolize the CPU
+                vruntime[idx] = min_vruntime;
+                timeline.insert({vruntime[idx], idx});
+                total_weight += weight[idx];
+            }
+        };
+
+        auto pick_next = [&]() {
+            running = timeline.begin()->second;
+            timeline.erase(timeline.begin());
+            stats.decisions++;
+
+            // Slice is the task's weighted share of the scheduling period
+            long long nr_running = timeline.size() + 1;
+            long long period = std::max<long long>(config.target_latency,
+                                                   nr_running * config.min_granularity);
+            long long slice = period * weight[running] / total_weight;
+            slice_left = static_cast<int>(std::max<long long>(slice, config.min_granularity));
+        };
+
+        while (completed < n) {
+            admit_arrivals();
+
+            if (running == -1) {
+                if (timeline.empty()) {
+                    // CPU idle - jump to the next arrival
+                    current_time = processes[arrival_order[next_arrival]].arrival_time;
+                    continue;
+                }
+                pick_next();
+            }
+
+            int run_time = std::min(slice_left, remaining_time[running]);
+            if (next_arrival < n) {
+                run_time = std::min(run_time, processes[arrival_order[next_arrival]].arrival_time - current_time);
+            }
+
+            current_time += run_time;
+            remaining_time[running] -= run_time;
+            slice_left -= run_time;
+            vruntime[running] += static_cast<double>(run_time) * NICE_0_WEIGHT / weight[running];
+
+            // min_vruntime only moves forward
+            double leftmost = timeline.empty() ? vruntime[running]
+                                               : std::min(vruntime[running], timeline.begin()->first);
+            min_vruntime = std::max(min_vruntime, leftmost);
+
+            if (remaining_time[running] == 0) {
+                completed++;
+                total_weight -= weight[running];
+                processes[running].completion_time = current_time;
+                processes[running].turnaround_time = processes[running].completion_time - processes[running].arrival_time;
+                processes[running].waiting_time = processes[running].turnaround_time - processes[running].burst_time;
+                running = -1;
+                continue;
+            }
+
+            if (slice_left == 0) {
+                timeline.insert({vruntime[running], running});
+                running = -1;
+                continue;
+            }
+
+            // Stopped early for an arrival: preempt if the newcomer is far enough behind
+            admit_arrivals();
+            if (!timeline.empty() &&
+                timeline.begin()->first + config.wakeup_granularity < vruntime[running]) {
+                timeline.insert({vruntime[running], running});
+                running = -1;
+                stats.preemptions++;
+            }
+        }
+
+        stats.scheduler_seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - wall_start).count();
+        stats.fairness = fairnessIndex(processes);
+        return stats;
+    }
+
+    static void displayStats(const Stats& stats) {
+        double ns_per_decision = stats.decisions > 0
+            ? stats.scheduler_seconds * 1e9 / stats.decisions : 0.0;
+        std::cout << "Scheduling decisions: " << stats.decisions
+                  << ", Wakeup preemptions: " << stats.preemptions << "\n";
+        std::cout << std::fixed << std::setprecision(1)
+                  << "Overhead per decision: " << ns_per_decision << " ns\n"
+                  << std::setprecision(4)
+                  << "Jain's fairness index: " << stats.fairness << "\n";
+        std::cout.unsetf(std::ios::fixed);
+        std::cout << std::setprecision(6);
+    }
+
+private:
+    CFSConfig config;
+};
+
+#endif // FAIR_SCHEDULER_H
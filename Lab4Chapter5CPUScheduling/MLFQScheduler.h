@@ -0,0 +1,283 @@
+// File: MLFQScheduler.h
+// Multi-level feedback queue scheduler with demotion, aging and priority boost
+
+#ifndef MLFQ_SCHEDULER_H
+#define MLFQ_SCHEDULER_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <utility>
+
+#include "ProcessTable.h"
+
+struct MLFQConfig {
+    std::vector<int> quantum = {2, 4, 8}; // allotment per level, level 0 first
+    int boost_interval = 100;            // move everything to level 0 every N units (0 = off)
+    int aging_threshold = 50;            // promote after waiting N units at one level (0 = off)
+    int starvation_threshold = 100;      // a single wait longer than this counts as starvation
+};
+
+// Level 0 is the highest priority. New arrivals enter level 0 and preempt any
+// process running at a lower level. A process that uses up its level's
+// allotment is demoted one level; the last level is plain Round Robin.
+// Every ready queue is an intrusive FIFO over per-process "next" links, so
+// push, pop and the whole-level splice done by a priority boost are all O(1).
+// The clock jumps from event to event (slice end, arrival or boost) instead of
+// ticking, which keeps million-process traces fast.
+class MLFQScheduler {
+public:
+    struct LevelStats {
+        long long cpu_time = 0;     // time spent running at this level
+        long long wait_time = 0;    // time spent queued before dispatches at this level
+        long long dispatches = 0;
+        long long completions = 0;
+    };
+
+    struct Stats {
+        std::vector<LevelStats> levels;
+        long long boosts = 0;
+        long long aging_promotions = 0;
+        long long demotions = 0;
+        long long starved_waits = 0; // waits longer than starvation_threshold
+        int max_wait = 0;            // longest single stretch in a ready queue
+    };
+
+    explicit MLFQScheduler(MLFQConfig cfg = MLFQConfig()) {
+        configure(std::move(cfg));
+    }
+
+    // Replaces the configuration; a scheduler reused across runs keeps its
+    // scratch buffers, so repeated runs stop allocating once they are warm
+    void configure(MLFQConfig cfg) {
+        config = std::move(cfg);
+        if (config.quantum.empty()) config.quantum.push_back(1);
+        for (auto& q : config.quantum) q = std::max(q, 1);
+    }
+
+    // Schedules processes and fills in completion, turnaround and waiting times
+    Stats schedule(std::vector<Process>& processes) {
+        const int n = processes.size();
+        const int levels = config.quantum.size();
+
+        Stats stats;
+        stats.levels.assign(levels, LevelStats());
+
+        queues.assign(levels, LevelQueue());
+        next_in_queue.assign(n, -1);
+        remaining_time.assign(n, 0);
+        used.assign(n, 0);
+        used_level.assign(n, 0);
+        ready_since.assign(n, 0);
+        level_since.assign(n, 0);
+        arrival_order.assign(n, 0);
+
+        for (int i = 0; i < n; i++) {
+            remaining_time[i] = processes[i].burst_time;
+            arrival_order[i] = i;
+        }
+        // Same sort and comparator as RoundRobinCursor, so equal arrivals
+        // are admitted in the same order and one level without boost or
+        // aging reproduces it exactly
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                  [&processes](int a, int b) {
+                      return processes[a].arrival_time < processes[b].arrival_time;
+                  });
+
+        int current_time = 0;
+        int completed = 0;
+        int next_arrival = 0; // cursor into arrival_order
+        int next_boost = config.boost_interval;
+
+        auto admit_arrivals = [&]() {
+            while (next_arrival < n &&
+                   processes[arrival_order[next_arrival]].arrival_time <= current_time) {
+                int idx = arrival_order[next_arrival++];
+                ready_since[idx] = processes[idx].arrival_time;
+                level_since[idx] = processes[idx].arrival_time;
+                pushBack(0, idx);
+            }
+        };
+
+        while (completed < n) {
+            admit_arrivals();
+
+            if (config.boost_interval > 0 && current_time >= next_boost) {
+                // Priority boost: every queued process goes back to level 0
+                for (int level = 1; level < levels; level++) {
+                    splice(0, level);
+                }
+                stats.boosts++;
+                next_boost = (current_time / config.boost_interval + 1) * config.boost_interval;
+            }
+
+            if (config.aging_threshold > 0) {
+                // Queues are FIFO in level_since order, so only heads can be due
+                for (int level = 1; level < levels; level++) {
+                    while (queues[level].head != -1 &&
+                           current_time - level_since[queues[level].head] >= config.aging_threshold) {
+                        int idx = popFront(level);
+                        level_since[idx] = current_time;
+                        pushBack(level - 1, idx);
+                        stats.aging_promotions++;
+                    }
+                }
+            }
+
+            int level = 0;
+            while (level < levels && queues[level].head == -1) level++;
+
+            if (level == levels) {
+                // CPU idle - jump to the next arrival
+                current_time = processes[arrival_order[next_arrival]].arrival_time;
+                continue;
+            }
+
+            int idx = popFront(level);
+            if (used_level[idx] != level) {
+                used[idx] = 0;
+                used_level[idx] = level;
+            }
+
+            int wait = current_time - ready_since[idx];
+            stats.levels[level].wait_time += wait;
+            stats.levels[level].dispatches++;
+            stats.max_wait = std::max(stats.max_wait, wait);
+            if (wait > config.starvation_threshold) stats.starved_waits++;
+
+            // Run until the allotment expires, the process finishes, or an
+            // event that can preempt it (arrival into level 0, boost) occurs
+            int slice = std::min(config.quantum[level] - used[idx], remaining_time[idx]);
+            if (level > 0) {
+                if (next_arrival < n) {
+                    slice = std::min(slice, processes[arrival_order[next_arrival]].arrival_time - current_time);
+                }
+                if (config.boost_interval > 0) {
+                    slice = std::min(slice, next_boost - current_time);
+                }
+            }
+
+            current_time += slice;
+            remaining_time[idx] -= slice;
+            used[idx] += slice;
+            stats.levels[level].cpu_time += slice;
+
+            admit_arrivals();
+
+            if (remaining_time[idx] == 0) {
+                completed++;
+                stats.levels[level].completions++;
+                processes[idx].completion_time = current_time;
+                processes[idx].turnaround_time = processes[idx].completion_time - processes[idx].arrival_time;
+                processes[idx].waiting_time = processes[idx].turnaround_time - processes[idx].burst_time;
+                continue;
+            }
+
+            int next_level = level;
+            if (used[idx] >= config.quantum[level]) {
+                // Allotment used up - demote (the last level round-robins)
+                if (level + 1 < levels) {
+                    next_level = level + 1;
+                    stats.demotions++;
+                }
+                used[idx] = 0;
+                used_level[idx] = next_level;
+            }
+            ready_since[idx] = current_time;
+            level_since[idx] = current_time;
+            pushBack(next_level, idx);
+        }
+
+        return stats;
+    }
+
+    void displayStats(const Stats& stats) const {
+        long long total_cpu = 0;
+        for (const auto& level : stats.levels) total_cpu += level.cpu_time;
+
+        std::cout << std::setw(7) << "Level"
+                  << std::setw(9) << "Quantum"
+                  << std::setw(11) << "CPU Time"
+                  << std::setw(8) << "CPU %"
+                  << std::setw(12) << "Dispatches"
+                  << std::setw(10) << "Avg Wait"
+                  << std::setw(13) << "Completions" << "\n";
+        std::cout << std::string(70, '-') << "\n";
+
+        for (size_t i = 0; i < stats.levels.size(); i++) {
+            const auto& level = stats.levels[i];
+            double share = total_cpu > 0 ? 100.0 * level.cpu_time / total_cpu : 0.0;
+            double avg_wait = level.dispatches > 0
+                ? static_cast<double>(level.wait_time) / level.dispatches : 0.0;
+            std::cout << std::setw(7) << i
+                      << std::setw(9) << config.quantum[i]
+                      << std::setw(11) << level.cpu_time
+                      << std::setw(8) << std::fixed << std::setprecision(1) << share
+                      << std::setw(12) << level.dispatches
+                      << std::setw(10) << std::setprecision(2) << avg_wait
+                      << std::setw(13) << level.completions << "\n";
+        }
+        std::cout.unsetf(std::ios::fixed);
+        std::cout << std::setprecision(6);
+
+        std::cout << "Demotions: " << stats.demotions
+                  << ", Aging promotions: " << stats.aging_promotions
+                  << ", Priority boosts: " << stats.boosts << "\n";
+        std::cout << "Longest wait: " << stats.max_wait
+                  << ", Waits over " << config.starvation_threshold << ": " << stats.starved_waits << "\n";
+    }
+
+private:
+    struct LevelQueue {
+        int head = -1;
+        int tail = -1;
+    };
+
+    MLFQConfig config;
+    std::vector<LevelQueue> queues;
+    std::vector<int> next_in_queue;
+
+    // Per-run state, indexed like the process vector
+    std::vector<int> remaining_time;
+    std::vector<int> used;          // allotment used at used_level
+    std::vector<int> used_level;
+    std::vector<int> ready_since;   // start of the current wait
+    std::vector<int> level_since;   // last enqueue at the current level, for aging
+    std::vector<int> arrival_order;
+
+    void pushBack(int level, int idx) {
+        LevelQueue& q = queues[level];
+        next_in_queue[idx] = -1;
+        if (q.tail == -1) {
+            q.head = idx;
+        } else {
+            next_in_queue[q.tail] = idx;
+        }
+        q.tail = idx;
+    }
+
+    int popFront(int level) {
+        LevelQueue& q = queues[level];
+        int idx = q.head;
+        q.head = next_in_queue[idx];
+        if (q.head == -1) q.tail = -1;
+        return idx;
+    }
+
+    // Append all of src to the back of dst in O(1)
+    void splice(int dst, int src) {
+        LevelQueue& from = queues[src];
+        if (from.head == -1) return;
+        LevelQueue& to = queues[dst];
+        if (to.tail == -1) {
+            to.head = from.head;
+        } else {
+            next_in_queue[to.tail] = from.head;
+        }
+        to.tail = from.tail;
+        from.head = from.tail = -1;
+    }
+};
+
+#endif // MLFQ_SCHEDULER_H
@@ -1,5 +1,21 @@
 // File: multiprocessor_scheduling.cpp
 // Compile: g++ -o multiprocessor_scheduling multiprocessor_scheduling.cpp -std=c++17 -pthread
+//
+// Usage: multiprocessor_scheduling [--virtual [tasks] [seed]]
+//        multiprocessor_scheduling --sweep [tasks] [seed] [thresholds]
+//        multiprocessor_scheduling --gang [groups] [seed]
+//        multiprocessor_scheduling --energy [tasks|trace.csv|trace.bin] [seed]
+//
+// --sweep runs the virtual-time workload once per load-balance threshold
+// (a "lo:hi[:step]" range or "a,b,c" list, default 0:8), flat and
+// topology-aware, in parallel on all hardware threads. --gang runs groups of
+// barrier-synchronized tasks with independent dispatch and with gang
+// scheduling and compares the time members spend stalled at barriers.
+// --energy replays a workload in virtual time under each placement strategy
+// (affinity only, global queue, work stealing) with race-to-idle and spread
+// DVFS governors and reports joules per task and tasks per joule. Trace
+// files use the scheduling_benchmark format, bursts in ms; two of every
+// three tasks are pinned to socket 0, as in the generated workload.
 
 #include <iostream>
 #include <vector>
@@ -13,61 +29,319 @@
 #include <algorithm>
 #include <climits>
 #include <memory>
+#include <functional>
+#include <string>
+#include <cstdlib>
+#include <cctype>
+#include <deque>
+#include <iomanip>
+#include <stdexcept>
+
+#include "WorkStealingDeque.h"
+#include "CPUTopology.h"
+#include "SchedulerTelemetry.h"
+#include "SweepRunner.h"
+#include "EnergyModel.h"
+#include "SchedulingTrace.h"
 
 class Task {
 public:
     int task_id;
     int burst_time;
     int preferred_cpu;
+    int migration_cost; // ms added to the run time by cross-CPU moves
+    int group_id;       // task group it must be co-scheduled with, -1 for none
     std::chrono::steady_clock::time_point arrival_time;
     std::chrono::steady_clock::time_point start_time;
     std::chrono::steady_clock::time_point completion_time;
     
     Task(int id, int burst, int cpu = -1) 
-        : task_id(id), burst_time(burst), preferred_cpu(cpu) {
+        : task_id(id), burst_time(burst), preferred_cpu(cpu), migration_cost(0), group_id(-1) {
         arrival_time = std::chrono::steady_clock::now();
     }
+    
+    // Virtual-time mode: time points are offsets from the simulation start
+    static std::chrono::steady_clock::time_point virtualTime(long long ms) {
+        return std::chrono::steady_clock::time_point(std::chrono::milliseconds(ms));
+    }
+};
+
+// Parks one thread until another thread unparks it (per-core wakeup)
+// An unpark that arrives before park() leaves a permit behind, so a wakeup is
+// never lost between "found no work" and "went to sleep". Park and unpark are
+// a single atomic exchange unless the thread really has to block.
+class Parker {
+private:
+    static constexpr int EMPTY = 0;
+    static constexpr int NOTIFIED = 1;
+    static constexpr int PARKED = 2;
+
+    std::atomic<int> state{EMPTY};
+    std::mutex park_mutex;
+    std::condition_variable park_cv;
+
+public:
+    void park() {
+        // Fast path: consume a pending permit
+        int expected = NOTIFIED;
+        if (state.compare_exchange_strong(expected, EMPTY)) return;
+
+        std::unique_lock<std::mutex> lock(park_mutex);
+        expected = EMPTY;
+        if (!state.compare_exchange_strong(expected, PARKED)) {
+            // Notified while taking the lock
+            state.store(EMPTY);
+            return;
+        }
+        do {
+            park_cv.wait(lock);
+            expected = NOTIFIED;
+        } while (!state.compare_exchange_strong(expected, EMPTY));
+    }
+
+    void unpark() {
+        if (state.exchange(NOTIFIED) != PARKED) return;
+        // Taking the lock orders this notify after the parker started waiting
+        { std::lock_guard<std::mutex> lock(park_mutex); }
+        park_cv.notify_one();
+    }
+};
+
+// Counts outstanding tasks; wait() blocks until the count reaches zero
+class CompletionLatch {
+private:
+    std::atomic<int> pending{0};
+    std::mutex latch_mutex;
+    std::condition_variable latch_cv;
+
+public:
+    void add(int n = 1) { pending += n; }
+
+    // Returns true for the call that brought the count to zero
+    bool countDown() {
+        if (pending.fetch_sub(1) != 1) return false;
+        { std::lock_guard<std::mutex> lock(latch_mutex); }
+        latch_cv.notify_all();
+        return true;
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(latch_mutex);
+        latch_cv.wait(lock, [this] { return pending.load() == 0; });
+    }
+
+    int count() const { return pending.load(); }
 };
 
 class CPUCore {
 public:
     int core_id;
-    std::queue<Task> local_queue;
-    std::mutex queue_mutex;
+    // Lock-free Chase-Lev deque: only this core's scheduler thread pushes and
+    // pops at the bottom, other cores steal from the top
+    WorkStealingDeque<Task*> local_queue;
+    // Tasks handed over by other threads wait here until the owner drains
+    // them; a deque so a thief can take the oldest one in O(1)
+    std::deque<Task*> inbox;
+    std::mutex inbox_mutex;
+    std::atomic<int> inbox_size{0};
     std::atomic<bool> is_busy{false};
     std::atomic<int> load{0};
+    // Idle cores park here instead of sleep-polling
+    Parker parker;
+    std::atomic<bool> is_idle{false};
+    // Owner only - reused by workStealing() so steals do not allocate
+    std::vector<Task*> steal_buffer;
     
     CPUCore(int id) : core_id(id) {}
     
+    ~CPUCore() {
+        Task* task;
+        while (local_queue.pop(task)) delete task;
+        for (Task* pending : inbox) delete pending;
+    }
+    
     // Delete copy constructor and assignment operator due to mutex
     CPUCore(const CPUCore&) = delete;
     CPUCore& operator=(const CPUCore&) = delete;
     
+    // Any thread
     void addTask(const Task& task) {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        local_queue.push(task);
+        std::lock_guard<std::mutex> lock(inbox_mutex);
+        inbox.push_back(new Task(task));
+        inbox_size++;
         load++;
     }
     
+    // Any thread - hand over a batch of heap tasks with one lock acquisition
+    void addTasks(const std::vector<Task*>& batch) {
+        std::lock_guard<std::mutex> lock(inbox_mutex);
+        inbox.insert(inbox.end(), batch.begin(), batch.end());
+        inbox_size += static_cast<int>(batch.size());
+        load += static_cast<int>(batch.size());
+    }
+    
+    // Owner only - queue tasks taken from other cores (skips the inbox)
+    void adoptTasks(std::vector<Task*>::const_iterator first, std::vector<Task*>::const_iterator last) {
+        for (auto it = first; it != last; ++it) {
+            local_queue.push(*it);
+            load++;
+        }
+    }
+    
+    // Owner only - newest task first (LIFO), as in any work-stealing runtime
     bool getTask(Task& task) {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        if (!local_queue.empty()) {
-            task = local_queue.front();
-            local_queue.pop();
+        if (inbox_size.load() > 0) {
+            drainInbox();
+        }
+        Task* next;
+        if (local_queue.pop(next)) {
+            task = *next;
+            delete next;
             load--;
             return true;
         }
         return false;
     }
     
+    // Other threads - oldest task first, falling back to the inbox
+    bool stealTask(Task& task) {
+        Task* stolen = nullptr;
+        if (!local_queue.steal(stolen)) {
+            if (inbox_size.load() == 0) return false;
+            std::lock_guard<std::mutex> lock(inbox_mutex);
+            if (inbox.empty()) return false;
+            stolen = inbox.front();
+            inbox.pop_front();
+            inbox_size--;
+        }
+        task = *stolen;
+        delete stolen;
+        load--;
+        return true;
+    }
+    
+    // Other threads - take up to half of the queue, oldest first. Deque slots
+    // are still claimed one CAS at a time: a thief that claimed a whole range
+    // at once could overlap the owner's CAS-free pop. Inbox tasks are taken
+    // in bulk under one lock hold.
+    int stealHalf(std::vector<Task*>& stolen) {
+        int want = (getQueueSize() + 1) / 2;
+        int taken = 0;
+        Task* task;
+        while (taken < want && local_queue.steal(task)) {
+            stolen.push_back(task);
+            taken++;
+        }
+        if (taken < want && inbox_size.load() > 0) {
+            std::lock_guard<std::mutex> lock(inbox_mutex);
+            int from_inbox = std::min(want - taken, static_cast<int>(inbox.size()));
+            stolen.insert(stolen.end(), inbox.begin(), inbox.begin() + from_inbox);
+            inbox.erase(inbox.begin(), inbox.begin() + from_inbox);
+            inbox_size -= from_inbox;
+            taken += from_inbox;
+        }
+        load -= taken;
+        return taken;
+    }
+    
+    // Lock-free; may be momentarily stale while other cores push or steal
     int getQueueSize() {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        return static_cast<int>(local_queue.size());
+        return static_cast<int>(local_queue.size()) + inbox_size.load();
     }
     
     bool isEmpty() {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        return local_queue.empty();
+        return getQueueSize() == 0;
+    }
+
+private:
+    // Owner only - move handed-over tasks into the deque in one lock hold
+    void drainInbox() {
+        std::lock_guard<std::mutex> lock(inbox_mutex);
+        for (Task* pending : inbox) {
+            local_queue.push(pending);
+        }
+        inbox.clear();
+        inbox_size = 0;
+    }
+};
+
+// Communicating tasks that synchronize at a barrier every sync_interval_ms
+// of compute: a member that reaches a barrier spins until every member of
+// its group has reached it
+struct TaskGroup {
+    int group_id;
+    int size;              // members, all with the same amount of work
+    int work_ms;           // compute per member
+    int sync_interval_ms;  // compute between barriers, 0 for none
+};
+
+// Ousterhout's scheduling matrix: one column per core, one row per time
+// slice. A group occupies size cells of a single row, so every member runs
+// in the same slice; rows are visited round robin.
+class GangMatrix {
+private:
+    const CPUTopology& topology;
+    std::vector<std::vector<int>> cells; // [row][core] = group index or -1
+    
+public:
+    explicit GangMatrix(const CPUTopology& topo) : topology(topo) {}
+    
+    // First fit: the first row with enough free cells. Within the row the
+    // group takes the tightest cluster of free cores (smallest largest
+    // distance from its first core), so members share caches where possible.
+    int place(int group, int size, std::vector<int>& columns) {
+        const int num_cores = topology.size();
+        for (size_t row = 0; row <= cells.size(); row++) {
+            if (row == cells.size()) cells.emplace_back(num_cores, -1);
+            std::vector<int>& slots = cells[row];
+            
+            int best_spread = CPUTopology::DISTANCE_LEVELS;
+            for (int first = 0; first < num_cores; first++) {
+                if (slots[first] != -1) continue;
+                std::vector<int> cluster = {first};
+                int spread = CPUTopology::SAME_CPU;
+                for (int core : topology.nearestFirst(first)) {
+                    if (static_cast<int>(cluster.size()) == size) break;
+                    if (slots[core] != -1) continue;
+                    cluster.push_back(core);
+                    spread = std::max(spread, static_cast<int>(topology.distance(first, core)));
+                }
+                if (static_cast<int>(cluster.size()) == size && spread < best_spread) {
+                    best_spread = spread;
+                    columns = cluster;
+                }
+            }
+            if (best_spread < CPUTopology::DISTANCE_LEVELS) {
+                for (int core : columns) slots[core] = group;
+                return static_cast<int>(row);
+            }
+        }
+        return -1; // unreachable: a fresh row always fits size <= cores
+    }
+    
+    void release(int row, int group) {
+        for (int& slot : cells[row]) {
+            if (slot == group) slot = -1;
+        }
+    }
+    
+    int rows() const { return static_cast<int>(cells.size()); }
+    int cell(int row, int core) const { return cells[row][core]; }
+};
+
+// Outcome of one task-group run, in core-milliseconds of virtual time
+struct GangStats {
+    long long makespan_ms = 0;
+    long long work_ms = 0;     // useful compute
+    long long stall_ms = 0;    // spinning at a barrier
+    long long idle_ms = 0;     // nothing runnable on the core
+    long long switches = 0;    // a core changing to a different member
+    double avg_group_completion_ms = 0.0;
+    int matrix_rows = 0;       // gang mode only
+    
+    double share(long long part) const {
+        long long total = work_ms + stall_ms + idle_ms;
+        return total > 0 ? 100.0 * part / total : 0.0;
     }
 };
 
@@ -76,156 +350,656 @@ private:
     std::vector<std::unique_ptr<CPUCore>> cores;
     std::queue<Task> global_queue;
     std::mutex global_mutex;
-    std::condition_variable cv;
+    std::atomic<int> global_size{0};
     std::atomic<bool> running{true};
-    std::atomic<int> active_tasks{0};
-    std::atomic<int> completed_tasks{0};
+    CompletionLatch active_tasks;
     int num_cores;
     
-    // Load balancing parameters
-    static constexpr int LOAD_BALANCE_THRESHOLD = 2;
-    static constexpr int MIGRATION_COST = 5; // milliseconds
+    // Victims are chosen nearest first and migrations pay the topology's cost;
+    // with topology_aware off every core looks equidistant (cost still charged)
+    CPUTopology topology;
+    bool topology_aware;
+    
+    // One padded slot per core instead of a std::cout line per event
+    std::vector<CoreTelemetry> telemetry;
+    std::chrono::steady_clock::time_point started_at;
+    long long virtual_now_ms = -1; // set while running in virtual time
+    
+    // Lets stop() interrupt the load balancer's period
+    std::mutex balancer_mutex;
+    std::condition_variable balancer_cv;
+    
+    // Load balancing parameters: a queue longer than the threshold is
+    // worth stealing from or balancing
+    int load_balance_threshold;
+    static constexpr int BALANCE_PERIOD_MS = 100;
     
 public:
-    MultiProcessorScheduler(int cores_count) : num_cores(cores_count) {
-        cores.reserve(cores_count);
-        for (int i = 0; i < cores_count; i++) {
+    // Where tasks go and who may move them
+    enum Placement {
+        AFFINITY,      // pinned tasks stay on their core, no stealing or balancing
+        GLOBAL_QUEUE,  // affinity ignored, every core pulls from one shared queue
+        WORK_STEALING  // affinity first, then the global queue, then steal
+    };
+    
+private:
+    Placement placement = WORK_STEALING;
+    
+    // Virtual-time DVFS: off unless an energy model is set
+    bool energy_enabled = false;
+    EnergyModel energy_model;
+    std::vector<CoreEnergy> core_energy;
+    
+public:
+    static constexpr int DEFAULT_LOAD_BALANCE_THRESHOLD = 2;
+    
+    MultiProcessorScheduler(int cores_count)
+        : MultiProcessorScheduler(CPUTopology::flat(cores_count)) {}
+    
+    MultiProcessorScheduler(const CPUTopology& topo, bool aware = true,
+                            int balance_threshold = DEFAULT_LOAD_BALANCE_THRESHOLD)
+        : num_cores(topo.size()), topology(topo), topology_aware(aware),
+          telemetry(topo.size()), started_at(std::chrono::steady_clock::now()),
+          load_balance_threshold(std::max(balance_threshold, 0)) {
+        cores.reserve(num_cores);
+        for (int i = 0; i < num_cores; i++) {
             cores.push_back(std::make_unique<CPUCore>(i));
         }
     }
     
+    void setPlacement(Placement p) { placement = p; }
+    
+    static const char* placementName(Placement p) {
+        static const char* names[] = {"affinity", "global-queue", "work-stealing"};
+        return names[p];
+    }
+    
+    // Enables P-states in virtual-time runs: each dispatch picks a P-state
+    // through the model's governor and the run time stretches to match
+    void setEnergyModel(const EnergyModel& model) {
+        energy_model = model;
+        energy_enabled = true;
+        core_energy.assign(num_cores, CoreEnergy());
+        for (auto& core : core_energy) core.pstate_ms.assign(model.pstates.size(), 0);
+    }
+    
     void addTask(const Task& task) {
-        if (task.preferred_cpu >= 0 && task.preferred_cpu < num_cores) {
+        active_tasks.add();
+        if (placement != GLOBAL_QUEUE && task.preferred_cpu >= 0 && task.preferred_cpu < num_cores) {
             // Processor affinity - try preferred CPU first
-            cores[task.preferred_cpu]->addTask(task);
+            CPUCore& core = *cores[task.preferred_cpu];
+            core.addTask(task);
+            wakeCore(task.preferred_cpu);
+            // A backlog beyond the steal threshold is work for an idle core too
+            if (core.getQueueSize() > load_balance_threshold) {
+                wakeIdleCore();
+            }
         } else {
             // Global queue for load balancing
-            std::lock_guard<std::mutex> lock(global_mutex);
-            global_queue.push(task);
+            {
+                std::lock_guard<std::mutex> lock(global_mutex);
+                global_queue.push(task);
+                global_size++;
+            }
+            wakeIdleCore();
+        }
+    }
+    
+    // Submit a burst of tasks at once. Each core's share is handed over under
+    // one inbox lock and each core gets at most one wakeup. Unpinned tasks
+    // are spread over the least loaded cores instead of the global queue.
+    void submitBatch(const std::vector<Task>& batch) {
+        if (batch.empty()) return;
+        active_tasks.add(static_cast<int>(batch.size()));
+        
+        if (placement == GLOBAL_QUEUE) {
+            {
+                std::lock_guard<std::mutex> lock(global_mutex);
+                for (const Task& task : batch) global_queue.push(task);
+                global_size += static_cast<int>(batch.size());
+            }
+            for (size_t i = 0; i < batch.size() && i < static_cast<size_t>(num_cores); i++) {
+                wakeIdleCore();
+            }
+            return;
+        }
+        
+        std::vector<std::vector<Task*>> per_core(num_cores);
+        std::vector<int> projected_load(num_cores);
+        for (int i = 0; i < num_cores; i++) {
+            projected_load[i] = cores[i]->getQueueSize() + (cores[i]->is_busy.load() ? 1 : 0);
+        }
+        for (const Task& task : batch) {
+            if (task.preferred_cpu >= 0 && task.preferred_cpu < num_cores) {
+                per_core[task.preferred_cpu].push_back(new Task(task));
+                projected_load[task.preferred_cpu]++;
+            }
+        }
+        
+        using Load = std::pair<int, int>; // (projected load, core)
+        std::priority_queue<Load, std::vector<Load>, std::greater<Load>> least_loaded;
+        for (int i = 0; i < num_cores; i++) least_loaded.push({projected_load[i], i});
+        for (const Task& task : batch) {
+            if (task.preferred_cpu >= 0 && task.preferred_cpu < num_cores) continue;
+            Load target = least_loaded.top();
+            least_loaded.pop();
+            per_core[target.second].push_back(new Task(task));
+            least_loaded.push({target.first + 1, target.second});
+        }
+        
+        bool overloaded = false;
+        for (int i = 0; i < num_cores; i++) {
+            if (per_core[i].empty()) continue;
+            cores[i]->addTasks(per_core[i]);
+            wakeCore(i);
+            overloaded = overloaded || cores[i]->getQueueSize() > load_balance_threshold;
+        }
+        // Pinned backlogs are work for a thief
+        if (overloaded) {
+            wakeIdleCore();
         }
-        active_tasks++;
-        cv.notify_all();
     }
     
     void cpuScheduler(int core_id) {
         std::cout << "CPU Core " << core_id << " scheduler started\n";
+        CPUCore& core = *cores[core_id];
         
-        while (running.load() || active_tasks.load() > 0) {
+        while (running.load() || active_tasks.count() > 0) {
             Task current_task(0, 0);
-            bool has_task = false;
             
-            // Try to get task from local queue first (processor affinity)
-            if (cores[core_id]->getTask(current_task)) {
-                has_task = true;
-            }
-            // Try global queue
-            else {
-                std::lock_guard<std::mutex> lock(global_mutex);
-                if (!global_queue.empty()) {
-                    current_task = global_queue.front();
-                    global_queue.pop();
-                    has_task = true;
-                }
-            }
-            
-            // Work stealing - try to steal from other cores
-            if (!has_task) {
-                has_task = workStealing(core_id, current_task);
+            if (findTask(core_id, current_task)) {
+                executeTask(core_id, current_task);
+                continue;
             }
             
-            if (has_task) {
-                executeTask(core_id, current_task);
-            } else {
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            // Advertise idleness before the final check: a producer either
+            // sees is_idle and unparks us, or we see its task here
+            core.is_idle.store(true);
+            if (hasWorkFor(core_id) || (!running.load() && active_tasks.count() == 0)) {
+                core.is_idle.store(false);
+                continue;
             }
+            CoreTelemetry::bump(telemetry[core_id].parks);
+            core.parker.park();
+            core.is_idle.store(false);
         }
         
         std::cout << "CPU Core " << core_id << " scheduler stopped\n";
     }
     
+    bool findTask(int core_id, Task& task) {
+        // Try to get task from local queue first (processor affinity)
+        if (cores[core_id]->getTask(task)) {
+            return true;
+        }
+        
+        // Try global queue
+        if (global_size.load() > 0) {
+            std::lock_guard<std::mutex> lock(global_mutex);
+            if (!global_queue.empty()) {
+                task = global_queue.front();
+                global_queue.pop();
+                global_size--;
+                return true;
+            }
+        }
+        
+        // Work stealing - try to steal from other cores
+        return placement == WORK_STEALING && workStealing(core_id, task);
+    }
+    
+    // Lock-free check for anything findTask() could pick up
+    bool hasWorkFor(int core_id) {
+        if (cores[core_id]->getQueueSize() > 0 || global_size.load() > 0) return true;
+        if (placement != WORK_STEALING) return false;
+        for (int i = 0; i < num_cores; i++) {
+            if (i != core_id && cores[i]->getQueueSize() > stealThreshold(core_id, i)) return true;
+        }
+        return false;
+    }
+    
+    // Backlog a victim needs before it is worth robbing: one extra queued task
+    // for every level beyond a shared last-level cache
+    int stealThreshold(int thief, int victim) const {
+        if (!topology_aware) return load_balance_threshold;
+        int level = topology.distance(thief, victim);
+        return load_balance_threshold + std::max(0, level - CPUTopology::SHARED_LLC);
+    }
+    
+    void chargeMigration(Task& task, int from, int to) {
+        int cost = topology.migrationCost(from, to);
+        task.migration_cost += cost;
+        CoreTelemetry::bump(telemetry[to].migration_cost_ms, cost);
+        CoreTelemetry::bump(telemetry[to].migrations[topology.distance(from, to)]);
+    }
+    
+    // Targeted wakeup of one core
+    void wakeCore(int core_id) {
+        CPUCore& core = *cores[core_id];
+        bool idle = true;
+        if (core.is_idle.compare_exchange_strong(idle, false)) {
+            core.parker.unpark();
+        }
+    }
+    
+    // Wake a single idle core, if any, instead of notifying everyone
+    void wakeIdleCore() {
+        for (int i = 0; i < num_cores; i++) {
+            bool idle = true;
+            if (cores[i]->is_idle.compare_exchange_strong(idle, false)) {
+                cores[i]->parker.unpark();
+                return;
+            }
+        }
+    }
+    
+    void wakeAllCores() {
+        for (auto& core : cores) {
+            core->is_idle.store(false);
+            core->parker.unpark();
+        }
+    }
+    
     bool workStealing(int core_id, Task& stolen_task) {
-        // Find the most loaded core
+        // Walk the victims nearest first; the most loaded core of the closest
+        // distance level with enough backlog wins
         int max_load = 0;
         int victim_core = -1;
+        int victim_level = CPUTopology::DISTANCE_LEVELS;
         
-        for (int i = 0; i < num_cores; i++) {
-            if (i != core_id && cores[i]->getQueueSize() > max_load + LOAD_BALANCE_THRESHOLD) {
-                max_load = cores[i]->getQueueSize();
+        for (int i : topology.nearestFirst(core_id)) {
+            int level = topology_aware ? topology.distance(core_id, i) : 0;
+            if (level > victim_level) break;
+            int queue_size = cores[i]->getQueueSize();
+            if (queue_size > stealThreshold(core_id, i) && queue_size > max_load) {
+                max_load = queue_size;
                 victim_core = i;
+                victim_level = level;
             }
         }
         
-        if (victim_core != -1 && cores[victim_core]->getTask(stolen_task)) {
-            std::cout << "Core " << core_id << " stole task " << stolen_task.task_id 
-                      << " from Core " << victim_core << "\n";
+        if (victim_core == -1) return false;
+        
+        // Steal half of the victim's queue: run the oldest, keep the rest
+        CPUCore& thief = *cores[core_id];
+        std::vector<Task*>& stolen = thief.steal_buffer;
+        stolen.clear();
+        if (cores[victim_core]->stealHalf(stolen) > 0) {
+            for (Task* task : stolen) {
+                chargeMigration(*task, victim_core, core_id);
+            }
+            stolen_task = *stolen.front();
+            delete stolen.front();
+            thief.adoptTasks(stolen.begin() + 1, stolen.end());
+            CoreTelemetry::bump(telemetry[core_id].steals, stolen.size());
             return true;
         }
         
+        CoreTelemetry::bump(telemetry[core_id].failed_steals);
         return false;
     }
     
     void executeTask(int core_id, Task& task) {
-        cores[core_id]->is_busy = true;
-        task.start_time = std::chrono::steady_clock::now();
+        beginTask(core_id, task, std::chrono::steady_clock::now());
         
-        std::cout << "Core " << core_id << " executing Task " << task.task_id 
-                  << " (Burst: " << task.burst_time << "ms)\n";
+        // Simulate task execution, plus cache refill / remote memory after migrations
+        std::this_thread::sleep_for(std::chrono::milliseconds(task.burst_time + task.migration_cost));
         
-        // Simulate task execution
-        std::this_thread::sleep_for(std::chrono::milliseconds(task.burst_time));
+        endTask(core_id, task, std::chrono::steady_clock::now());
+    }
+    
+    // Dispatch bookkeeping, shared by the threaded and virtual-time modes
+    void beginTask(int core_id, Task& task, std::chrono::steady_clock::time_point now) {
+        cores[core_id]->is_busy = true;
+        task.start_time = now;
         
-        task.completion_time = std::chrono::steady_clock::now();
+        long long dispatch_latency = std::chrono::duration_cast<std::chrono::microseconds>
+            (task.start_time - task.arrival_time).count();
+        CoreTelemetry& slot = telemetry[core_id];
+        CoreTelemetry::bump(slot.dispatched);
+        slot.queue_depth.record(cores[core_id]->getQueueSize());
+        slot.wait_us.record(std::max(dispatch_latency, 0LL));
+    }
+    
+    void endTask(int core_id, Task& task, std::chrono::steady_clock::time_point now) {
+        task.completion_time = now;
         
         auto turnaround_time = std::chrono::duration_cast<std::chrono::milliseconds>
             (task.completion_time - task.arrival_time);
-        
-        std::cout << "Core " << core_id << " completed Task " << task.task_id 
-                  << " (Turnaround: " << turnaround_time.count() << "ms)\n";
+        CoreTelemetry& slot = telemetry[core_id];
+        CoreTelemetry::bump(slot.turnaround_ms, turnaround_time.count());
+        CoreTelemetry::bump(slot.completed);
         
         cores[core_id]->is_busy = false;
-        active_tasks--;
-        completed_tasks++;
+        if (active_tasks.countDown() && !running.load()) {
+            // Last task after stop(): let parked cores see the exit condition
+            wakeAllCores();
+        }
     }
     
     void loadBalancer() {
         while (running.load()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            {
+                std::unique_lock<std::mutex> lock(balancer_mutex);
+                balancer_cv.wait_for(lock, std::chrono::milliseconds(BALANCE_PERIOD_MS),
+                                     [this] { return !running.load(); });
+            }
+            if (!running.load()) break;
             
-            // Check load imbalance
-            int min_load = INT_MAX;
-            int max_load = 0;
-            int min_core = -1;
-            int max_core = -1;
+            balanceLoad();
+        }
+    }
+    
+    // One load balancer pass: move a task from the busiest queue if needed
+    void balanceLoad() {
+        if (placement != WORK_STEALING) return;
+        
+        // Check load imbalance
+        int max_load = 0;
+        int max_core = -1;
+        
+        for (int i = 0; i < num_cores; i++) {
+            int load = cores[i]->getQueueSize();
+            if (load > max_load) {
+                max_load = load;
+                max_core = i;
+            }
+        }
+        if (max_core == -1) return;
+        
+        // Target the least loaded core, counting distance as extra load so
+        // a nearby core wins over an equally idle remote one
+        int min_load = INT_MAX;
+        int min_core = -1;
+        for (int i : topology.nearestFirst(max_core)) {
+            int load = cores[i]->getQueueSize() +
+                       stealThreshold(i, max_core) - load_balance_threshold;
+            if (load < min_load) {
+                min_load = load;
+                min_core = i;
+            }
+        }
+        
+        // Migrate tasks if imbalance is significant
+        if (min_core != -1 && max_load - min_load > load_balance_threshold) {
+            Task migrated_task(0, 0);
+            if (cores[max_core]->stealTask(migrated_task)) {
+                chargeMigration(migrated_task, max_core, min_core);
+                cores[min_core]->addTask(migrated_task);
+                wakeCore(min_core);
+            }
+        }
+    }
+    
+    // Discrete-event run on a virtual clock: the same queues, stealing,
+    // balancing and migration costs as the threaded mode, driven by an event
+    // queue instead of threads and sleeps. next_arrival yields tasks in arrival
+    // order, with arrival_time = Task::virtualTime(ms). Results depend only on
+    // the input. Returns the makespan in virtual milliseconds.
+    long long runVirtual(const std::function<bool(Task&)>& next_arrival) {
+        using Event = std::pair<long long, int>; // (completion time, core)
+        std::priority_queue<Event, std::vector<Event>, std::greater<Event>> completions;
+        std::vector<Task> on_core(num_cores, Task(0, 0));
+        std::vector<bool> busy(num_cores, false);
+        
+        long long now = 0;
+        long long next_balance = BALANCE_PERIOD_MS;
+        Task pending(0, 0);
+        bool has_pending = next_arrival(pending);
+        
+        auto arrivalMs = [](const Task& task) -> long long {
+            return std::chrono::duration_cast<std::chrono::milliseconds>
+                (task.arrival_time.time_since_epoch()).count();
+        };
+        
+        while (has_pending || !completions.empty()) {
+            // Advance to the earliest event
+            long long next = completions.empty() ? LLONG_MAX : completions.top().first;
+            if (has_pending) next = std::min(next, arrivalMs(pending));
+            bool queued = active_tasks.count() > static_cast<int>(completions.size());
+            if (queued) {
+                next = std::min(next, next_balance);
+            } else if (next_balance <= next) {
+                // Nothing to balance: skip the balancer ticks up to the next event
+                next_balance = (next / BALANCE_PERIOD_MS + 1) * BALANCE_PERIOD_MS;
+            }
+            now = next;
+            virtual_now_ms = now;
             
-            for (int i = 0; i < num_cores; i++) {
-                int load = cores[i]->getQueueSize();
-                if (load < min_load) {
-                    min_load = load;
-                    min_core = i;
+            while (!completions.empty() && completions.top().first == now) {
+                int core_id = completions.top().second;
+                completions.pop();
+                endTask(core_id, on_core[core_id], Task::virtualTime(now));
+                busy[core_id] = false;
+            }
+            while (has_pending && arrivalMs(pending) == now) {
+                addTask(pending);
+                has_pending = next_arrival(pending);
+            }
+            if (now == next_balance) {
+                balanceLoad();
+                next_balance += BALANCE_PERIOD_MS;
+            }
+            
+            // Every idle core looks for work, lowest id first
+            for (int core_id = 0; core_id < num_cores; core_id++) {
+                if (busy[core_id] || !findTask(core_id, on_core[core_id])) continue;
+                Task& task = on_core[core_id];
+                beginTask(core_id, task, Task::virtualTime(now));
+                busy[core_id] = true;
+                long long run_ms = task.burst_time + task.migration_cost;
+                if (energy_enabled) run_ms = chargeEnergy(core_id, run_ms);
+                completions.push({now + run_ms, core_id});
+            }
+        }
+        return now;
+    }
+    
+    // Runs task groups in virtual time, 1ms steps, and measures barrier
+    // stalls. coschedule=true places every group in the gang matrix and
+    // gives all its members the same slice, filling cells left idle with any
+    // other group whose whole column set is free ("alternate" scheduling).
+    // coschedule=false is independent dispatch: members are spread over the
+    // least loaded cores and each core round-robins its own queue, so a
+    // member can spin through its slice waiting for a sibling that is not
+    // running. A spinning member keeps its core until its slice ends.
+    GangStats runGangVirtual(const std::vector<TaskGroup>& groups, bool coschedule, int slice_ms) {
+        slice_ms = std::max(slice_ms, 1);
+        const int group_count = static_cast<int>(groups.size());
+        
+        std::vector<Task> members;
+        std::vector<int> first_member(group_count + 1, 0);
+        for (int g = 0; g < group_count; g++) {
+            const TaskGroup& group = groups[g];
+            if (group.size < 1 || group.size > num_cores || group.work_ms < 1) {
+                throw std::invalid_argument("task group " + std::to_string(group.group_id) +
+                                            " needs 1.." + std::to_string(num_cores) +
+                                            " members and positive work");
+            }
+            first_member[g] = static_cast<int>(members.size());
+            for (int m = 0; m < group.size; m++) {
+                members.emplace_back(static_cast<int>(members.size()) + 1, group.work_ms);
+                members.back().group_id = g;
+            }
+        }
+        first_member[group_count] = static_cast<int>(members.size());
+        
+        std::vector<int> done(members.size(), 0);       // compute finished per member
+        std::vector<int> barriers_passed(group_count, 0);
+        std::vector<int> unfinished(group_count);
+        std::vector<long long> completed_at(group_count, 0);
+        for (int g = 0; g < group_count; g++) unfinished[g] = groups[g].size;
+        int groups_left = group_count;
+        
+        GangStats stats;
+        long long now = 0;
+        std::vector<int> running(num_cores, -1), last_run(num_cores, -1);
+        
+        auto finished = [&](int m) { return done[m] == members[m].burst_time; };
+        auto stalled = [&](int m) {
+            const TaskGroup& group = groups[members[m].group_id];
+            return group.sync_interval_ms > 0 && !finished(m) && done[m] > 0 &&
+                   done[m] % group.sync_interval_ms == 0 &&
+                   done[m] / group.sync_interval_ms > barriers_passed[members[m].group_id];
+        };
+        
+        // One millisecond on every core; running[] holds each core's member
+        auto tick = [&]() {
+            for (int core = 0; core < num_cores; core++) {
+                int m = running[core];
+                if (m == -1 || finished(m)) {
+                    stats.idle_ms++;
+                    continue;
+                }
+                if (m != last_run[core]) {
+                    stats.switches++;
+                    last_run[core] = m;
                 }
-                if (load > max_load) {
-                    max_load = load;
-                    max_core = i;
+                if (stalled(m)) {
+                    stats.stall_ms++;
+                    continue;
+                }
+                done[m]++;
+                stats.work_ms++;
+                if (finished(m) && --unfinished[members[m].group_id] == 0) {
+                    completed_at[members[m].group_id] = now + 1;
+                    groups_left--;
                 }
             }
+            now++;
+            // A barrier opens once the slowest member has reached it
+            for (int g = 0; g < group_count; g++) {
+                if (unfinished[g] == 0 || groups[g].sync_interval_ms <= 0) continue;
+                int slowest = INT_MAX;
+                for (int m = first_member[g]; m < first_member[g + 1]; m++) {
+                    slowest = std::min(slowest, done[m]);
+                }
+                barriers_passed[g] = slowest / groups[g].sync_interval_ms;
+            }
+        };
+        
+        if (coschedule) {
+            GangMatrix matrix(topology);
+            std::vector<int> row_of(group_count);
+            std::vector<std::vector<int>> columns_of(group_count);
+            for (int g = 0; g < group_count; g++) {
+                row_of[g] = matrix.place(g, groups[g].size, columns_of[g]);
+            }
+            stats.matrix_rows = matrix.rows();
             
-            // Migrate tasks if imbalance is significant
-            if (max_load - min_load > LOAD_BALANCE_THRESHOLD && max_core != -1 && min_core != -1) {
-                Task migrated_task(0, 0);
-                if (cores[max_core]->getTask(migrated_task)) {
-                    cores[min_core]->addTask(migrated_task);
-                    std::cout << "Load Balancer: Migrated Task " << migrated_task.task_id 
-                              << " from Core " << max_core << " to Core " << min_core << "\n";
+            int row = -1;
+            while (groups_left > 0) {
+                // Next row that still has a group in it
+                do {
+                    row = (row + 1) % matrix.rows();
+                } while ([&]() {
+                    for (int core = 0; core < num_cores; core++) {
+                        if (matrix.cell(row, core) != -1) return false;
+                    }
+                    return true;
+                }());
+                
+                std::fill(running.begin(), running.end(), -1);
+                auto assign = [&](int g) {
+                    for (int i = 0; i < groups[g].size; i++) {
+                        running[columns_of[g][i]] = first_member[g] + i;
+                    }
+                };
+                for (int g = 0; g < group_count; g++) {
+                    if (unfinished[g] > 0 && row_of[g] == row) assign(g);
+                }
+                // Alternates: other rows' groups whose columns are all free
+                for (int g = 0; g < group_count; g++) {
+                    if (unfinished[g] == 0 || row_of[g] == row) continue;
+                    bool fits = true;
+                    for (int core : columns_of[g]) fits = fits && running[core] == -1;
+                    if (fits) assign(g);
+                }
+                
+                for (int t = 0; t < slice_ms; t++) {
+                    tick();
+                    bool any_left = false;
+                    for (int core = 0; core < num_cores; core++) {
+                        any_left = any_left || (running[core] != -1 && !finished(running[core]));
+                    }
+                    if (!any_left) break; // the row drained early
+                }
+                for (int g = 0; g < group_count; g++) {
+                    if (unfinished[g] == 0 && row_of[g] >= 0) {
+                        matrix.release(row_of[g], g);
+                        row_of[g] = -1;
+                    }
+                }
+            }
+        } else {
+            // Least loaded placement by queued work, then per-core round robin
+            std::vector<std::deque<int>> queues(num_cores);
+            std::vector<long long> queued_work(num_cores, 0);
+            for (int m = 0; m < static_cast<int>(members.size()); m++) {
+                int target = static_cast<int>(std::min_element(queued_work.begin(), queued_work.end()) -
+                                              queued_work.begin());
+                queues[target].push_back(m);
+                queued_work[target] += members[m].burst_time;
+            }
+            std::vector<int> slice_used(num_cores, 0);
+            
+            while (groups_left > 0) {
+                for (int core = 0; core < num_cores; core++) {
+                    running[core] = queues[core].empty() ? -1 : queues[core].front();
+                }
+                tick();
+                for (int core = 0; core < num_cores; core++) {
+                    if (running[core] == -1) continue;
+                    if (finished(running[core])) {
+                        queues[core].pop_front();
+                        slice_used[core] = 0;
+                    } else if (++slice_used[core] == slice_ms) {
+                        queues[core].push_back(queues[core].front());
+                        queues[core].pop_front();
+                        slice_used[core] = 0;
+                    }
                 }
             }
         }
+        
+        stats.makespan_ms = now;
+        long long completion_sum = 0;
+        for (long long t : completed_at) completion_sum += t;
+        stats.avg_group_completion_ms = group_count > 0 ? static_cast<double>(completion_sum) / group_count : 0.0;
+        return stats;
     }
     
-    void waitForCompletion() {
-        // Wait until all tasks are completed
-        while (active_tasks.load() > 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // Picks the dispatch's P-state and books its energy; returns the
+    // stretched run time. The backlog counts this core's queue plus its share
+    // of the global queue.
+    long long chargeEnergy(int core_id, long long work_ms) {
+        int queued = cores[core_id]->getQueueSize() + global_size.load() / num_cores;
+        int pstate = energy_model.choose(queued);
+        long long run_ms = energy_model.runTime(work_ms, pstate);
+        CoreEnergy& energy = core_energy[core_id];
+        energy.busy_ms += run_ms;
+        energy.pstate_ms[pstate] += run_ms;
+        energy.active_joules += energy_model.pstates[pstate].active_watts * run_ms / 1000.0;
+        return run_ms;
+    }
+    
+    // Energy of a finished virtual-time run; every core idles until makespan
+    EnergyReport energyReport(long long makespan_ms) const {
+        EnergyReport report;
+        report.makespan_ms = makespan_ms;
+        report.tasks = static_cast<long long>(snapshot().total().completed);
+        report.pstate_ms.assign(energy_model.pstates.size(), 0);
+        for (const auto& core : core_energy) {
+            report.active_joules += core.active_joules;
+            report.idle_joules += energy_model.idle_watts * std::max(0LL, makespan_ms - core.busy_ms) / 1000.0;
+            for (size_t i = 0; i < core.pstate_ms.size(); i++) report.pstate_ms[i] += core.pstate_ms[i];
         }
+        return report;
+    }
+    
+    void waitForCompletion() {
+        // Block on the latch until all tasks are completed
+        active_tasks.wait();
     }
     
     void displayStats() {
@@ -234,13 +1008,42 @@ public:
             std::cout << "Core " << i << ": Queue Size = " << cores[i]->getQueueSize()
                       << ", Busy = " << (cores[i]->is_busy.load() ? "Yes" : "No") << "\n";
         }
-        std::cout << "Active Tasks: " << active_tasks.load() << "\n";
-        std::cout << "Completed Tasks: " << completed_tasks.load() << "\n";
+        CoreSnapshot all = snapshot().total();
+        std::cout << "Active Tasks: " << active_tasks.count() << "\n";
+        std::cout << "Completed Tasks: " << all.completed << "\n";
+        std::cout << "Dispatch Latency: p50 " << all.wait_us.percentile(0.50)
+                  << "us, p99 " << all.wait_us.percentile(0.99)
+                  << "us, max " << all.wait_us.max << "us\n";
+        std::cout << "Average Turnaround: " << static_cast<long long>(all.averageTurnaround()) << "ms\n";
+        std::cout << "Steals: " << all.steals << " (lost races: " << all.failed_steals << ")\n";
+        std::cout << "Migrations:";
+        for (int level = CPUTopology::SMT_SIBLING; level < CPUTopology::DISTANCE_LEVELS; level++) {
+            std::cout << " " << CPUTopology::distanceName(level) << "=" << all.migrations[level];
+        }
+        std::cout << "\nMigration Cost Charged: " << all.migration_cost_ms << "ms\n";
+    }
+    
+    // Aggregates the per-core slots; safe to call while cores are running.
+    // Elapsed time is wall time, or the virtual clock in virtual-time mode.
+    TelemetrySnapshot snapshot() const {
+        TelemetrySnapshot snap;
+        snap.elapsed_seconds = virtual_now_ms >= 0
+            ? virtual_now_ms / 1000.0
+            : std::chrono::duration<double>(std::chrono::steady_clock::now() - started_at).count();
+        snap.cores.reserve(num_cores);
+        for (int i = 0; i < num_cores; i++) {
+            snap.cores.push_back(CoreSnapshot::of(i, telemetry[i]));
+        }
+        return snap;
     }
     
     void stop() {
         running = false;
-        cv.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(balancer_mutex);
+        }
+        balancer_cv.notify_all();
+        wakeAllCores();
     }
 };
 
@@ -302,49 +1105,378 @@ public:
     }
 };
 
-int main() {
+// Runs one workload on a fresh scheduler and prints its statistics; batched
+// submits the whole workload in one submitBatch() call instead of one by one
+void runWorkload(const CPUTopology& topology, bool topology_aware, const std::vector<Task>& workload,
+                 bool batched = false) {
+    MultiProcessorScheduler scheduler(topology, topology_aware);
+    const int num_cores = topology.size();
+    
+    // Start CPU schedulers
+    std::vector<std::thread> cpu_threads;
+    for (int i = 0; i < num_cores; i++) {
+        cpu_threads.emplace_back(&MultiProcessorScheduler::cpuScheduler, &scheduler, i);
+    }
+    
+    // Start load balancer
+    std::thread load_balancer_thread(&MultiProcessorScheduler::loadBalancer, &scheduler);
+    
+    if (batched) {
+        std::vector<Task> batch;
+        batch.reserve(workload.size());
+        for (const Task& spec : workload) {
+            batch.emplace_back(spec.task_id, spec.burst_time, spec.preferred_cpu);
+        }
+        scheduler.submitBatch(batch);
+        std::cout << "Submitted " << batch.size() << " tasks in one batch\n";
+    } else {
+        for (const Task& spec : workload) {
+            // Fresh Task so arrival_time is the submission time of this run
+            Task task(spec.task_id, spec.burst_time, spec.preferred_cpu);
+            scheduler.addTask(task);
+            
+            if (task.preferred_cpu >= 0) {
+                std::cout << "Added Task " << task.task_id << " with CPU affinity to Core " << task.preferred_cpu << "\n";
+            } else {
+                std::cout << "Added Task " << task.task_id << " without CPU affinity\n";
+            }
+            
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    
+    std::cout << "\nTelemetry snapshot after submission (CSV):\n";
+    scheduler.snapshot().writeCSV(std::cout);
+    
+    // Wait for all tasks to complete
+    scheduler.waitForCompletion();
+    
+    scheduler.displayStats();
+    std::cout << "\nFinal telemetry snapshot (JSON):\n";
+    scheduler.snapshot().writeJSON(std::cout);
+    
+    // Stop scheduler
+    scheduler.stop();
+    
+    if (load_balancer_thread.joinable()) {
+        load_balancer_thread.join();
+    }
+    
+    for (auto& thread : cpu_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+// Synthetic virtual-time workload: bursts of 50-200ms at 90% load, two
+// thirds of the tasks pinned to socket 0 as in the threaded demo. Tasks are
+// generated on demand, so a run never holds the whole workload in memory.
+class VirtualWorkload {
+private:
+    long long count;
+    long long generated = 0;
+    double clock = 0.0;
+    std::mt19937 gen;
+    std::uniform_int_distribution<> burst_dist;
+    std::uniform_int_distribution<> affinity_dist;
+    std::exponential_distribution<> gap_dist;
+    
+public:
+    VirtualWorkload(int num_cores, long long task_count, unsigned seed)
+        : count(task_count), gen(seed), burst_dist(50, 200),
+          affinity_dist(0, std::max(num_cores / 2, 1) - 1),
+          gap_dist(num_cores * 0.9 / 125.0) {}
+    
+    bool next(Task& task) {
+        if (generated == count) return false;
+        generated++;
+        clock += gap_dist(gen);
+        int burst_time = burst_dist(gen);
+        int preferred_cpu = (generated % 3 != 0) ? affinity_dist(gen) : -1;
+        task = Task(static_cast<int>(generated), burst_time, preferred_cpu);
+        task.arrival_time = Task::virtualTime(static_cast<long long>(clock));
+        return true;
+    }
+};
+
+void runVirtualWorkload(const CPUTopology& topology, bool topology_aware, long long count,
+                        unsigned seed) {
+    MultiProcessorScheduler scheduler(topology, topology_aware);
+    VirtualWorkload workload(topology.size(), count, seed);
+    
+    auto wall_start = std::chrono::steady_clock::now();
+    long long makespan = scheduler.runVirtual([&workload](Task& task) { return workload.next(task); });
+    double wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    
+    scheduler.displayStats();
+    std::cout << "Virtual Makespan: " << makespan / 1000.0 << "s, simulated in "
+              << wall_seconds << "s wall time\n";
+}
+
+// Every (threshold, aware) point replays the same seeded workload on its own
+// scheduler; results land in one columnar table
+int runThresholdSweep(const CPUTopology& topology, long long count, unsigned seed,
+                      const std::string& thresholds) {
+    SweepAxis threshold_axis, aware_axis;
+    if (!SweepAxis::parse("threshold", thresholds, threshold_axis) ||
+        !SweepAxis::parse("aware", "0,1", aware_axis)) {
+        std::cerr << "Error: bad threshold list " << thresholds << "\n";
+        return 1;
+    }
+    SweepGrid grid;
+    grid.add(threshold_axis);
+    grid.add(aware_axis);
+    
+    enum { MAKESPAN_S, AVG_TURNAROUND_MS, WAIT_P99_MS, STEALS, MIGRATIONS, MIGRATION_COST_MS };
+    SweepTable table(grid, {"makespan_s", "avg_turnaround_ms", "wait_p99_ms", "steals",
+                            "migrations", "migration_cost_ms"});
+    int workers = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    
+    std::cout << "=== LOAD BALANCE THRESHOLD SWEEP ===\n";
+    std::cout << count << " tasks per run, seed " << seed << ", " << grid.size()
+              << " runs on " << workers << " workers\n";
+    
+    auto wall_start = std::chrono::steady_clock::now();
+    runSweep(grid, table, workers,
+        [&](const std::vector<int>& params, SweepTable& results, long long row) {
+            MultiProcessorScheduler scheduler(topology, params[1] != 0, params[0]);
+            VirtualWorkload workload(topology.size(), count, seed);
+            long long makespan = scheduler.runVirtual([&workload](Task& task) { return workload.next(task); });
+            
+            CoreSnapshot all = scheduler.snapshot().total();
+            results.metric(row, MAKESPAN_S) = makespan / 1000.0;
+            results.metric(row, AVG_TURNAROUND_MS) = all.averageTurnaround();
+            results.metric(row, WAIT_P99_MS) = all.wait_us.percentile(0.99) / 1000.0;
+            results.metric(row, STEALS) = static_cast<double>(all.steals);
+            results.metric(row, MIGRATIONS) = static_cast<double>(all.totalMigrations());
+            results.metric(row, MIGRATION_COST_MS) = static_cast<double>(all.migration_cost_ms);
+        });
+    double wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    
+    std::cout << "Sweep finished in " << wall_seconds << "s\n\n";
+    table.writeCSV(std::cout);
+    std::cout << "\nLowest average turnaround:\n  ";
+    table.displayRow(table.best(table.column("avg_turnaround_ms")));
+    std::cout << "Lowest p99 dispatch wait:\n  ";
+    table.displayRow(table.best(table.column("wait_p99_ms")));
+    return 0;
+}
+
+// Seeded mix of 2-4 member groups that synchronize every 5-20ms, run with
+// independent dispatch and with gang scheduling at two slice lengths
+int runGangComparison(const CPUTopology& topology, int group_count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> size_dist(2, std::max(2, topology.size()));
+    std::uniform_int_distribution<> work_dist(100, 400);
+    std::uniform_int_distribution<> sync_dist(5, 20);
+    
+    std::vector<TaskGroup> groups;
+    for (int g = 0; g < group_count; g++) {
+        groups.push_back({g + 1, std::min(size_dist(gen), topology.size()), work_dist(gen), sync_dist(gen)});
+    }
+    
+    std::cout << "=== GANG SCHEDULING ===\n";
+    std::cout << group_count << " task groups, seed " << seed << "\n\n";
+    std::cout << std::left << std::setw(14) << "Dispatch" << std::right
+              << std::setw(8) << "Slice"
+              << std::setw(12) << "Makespan"
+              << std::setw(10) << "Work%"
+              << std::setw(10) << "Stall%"
+              << std::setw(10) << "Idle%"
+              << std::setw(12) << "Switches"
+              << std::setw(14) << "AvgGroupDone" << "\n";
+    std::cout << std::string(90, '-') << "\n";
+    
+    for (int slice_ms : {10, 50}) {
+        GangStats results[2];
+        for (int coschedule = 0; coschedule < 2; coschedule++) {
+            MultiProcessorScheduler scheduler(topology);
+            GangStats& stats = results[coschedule];
+            stats = scheduler.runGangVirtual(groups, coschedule != 0, slice_ms);
+            std::cout << std::fixed << std::setprecision(1)
+                      << std::left << std::setw(14) << (coschedule ? "gang" : "independent") << std::right
+                      << std::setw(8) << slice_ms
+                      << std::setw(12) << stats.makespan_ms
+                      << std::setw(10) << stats.share(stats.work_ms)
+                      << std::setw(10) << stats.share(stats.stall_ms)
+                      << std::setw(10) << stats.share(stats.idle_ms)
+                      << std::setw(12) << stats.switches
+                      << std::setw(14) << stats.avg_group_completion_ms << "\n";
+            std::cout.unsetf(std::ios::fixed);
+        }
+        long long saved = results[0].stall_ms - results[1].stall_ms;
+        std::cout << "  slice " << slice_ms << "ms: co-scheduling removes " << saved
+                  << " of " << results[0].stall_ms << " stalled core-ms ("
+                  << (results[0].stall_ms > 0 ? 100 * saved / results[0].stall_ms : 0)
+                  << "%), matrix rows: " << results[1].matrix_rows << "\n";
+    }
+    std::cout << std::setprecision(6);
+    return 0;
+}
+
+// Virtual-time energy comparison of every placement strategy under both
+// governors, on a generated workload or a batch trace
+int runEnergyComparison(const CPUTopology& topology, const std::string& source, unsigned seed) {
+    const bool from_trace = !source.empty() && !std::isdigit(static_cast<unsigned char>(source[0]));
+    long long count = from_trace ? 0 : (source.empty() ? 200000 : std::atoll(source.c_str()));
+    if (from_trace && !TraceReader(source).isOpen()) {
+        std::cerr << "Error: cannot open trace " << source << "\n";
+        return 1;
+    }
+    
+    EnergyModel model;
+    std::cout << "=== ENERGY / DVFS COMPARISON ===\n";
+    std::cout << "Workload: " << (from_trace ? source : std::to_string(count) + " generated tasks, seed " + std::to_string(seed))
+              << "\nP-states:";
+    for (const auto& state : model.pstates) {
+        std::cout << " " << state.mhz << "MHz/" << state.active_watts << "W";
+    }
+    std::cout << ", idle " << model.idle_watts << "W\n\n";
+    std::cout << std::left << std::setw(15) << "Placement" << std::setw(14) << "Governor" << std::right
+              << std::setw(11) << "Makespan"
+              << std::setw(10) << "Tasks/s"
+              << std::setw(12) << "Energy(J)"
+              << std::setw(8) << "AvgW"
+              << std::setw(9) << "J/Task"
+              << std::setw(9) << "Tasks/J"
+              << std::setw(11) << "AvgTurn"
+              << std::setw(7) << "Top%" << "\n";
+    std::cout << std::string(106, '-') << "\n";
+    
+    for (auto placement : {MultiProcessorScheduler::AFFINITY, MultiProcessorScheduler::GLOBAL_QUEUE,
+                           MultiProcessorScheduler::WORK_STEALING}) {
+        for (auto governor : {EnergyModel::RACE_TO_IDLE, EnergyModel::SPREAD}) {
+            MultiProcessorScheduler scheduler(topology, true);
+            scheduler.setPlacement(placement);
+            model.governor = governor;
+            scheduler.setEnergyModel(model);
+            
+            long long makespan;
+            if (from_trace) {
+                TraceReader reader(source);
+                TraceRecord record;
+                const int socket_cores = std::max(topology.size() / 2, 1);
+                makespan = scheduler.runVirtual([&](Task& task) {
+                    if (!reader.next(record)) return false;
+                    int preferred_cpu = (record.pid % 3 != 0) ? record.pid % socket_cores : -1;
+                    task = Task(record.pid, std::max(record.burst, 1), preferred_cpu);
+                    task.arrival_time = Task::virtualTime(record.arrival);
+                    return true;
+                });
+            } else {
+                VirtualWorkload workload(topology.size(), count, seed);
+                makespan = scheduler.runVirtual([&workload](Task& task) { return workload.next(task); });
+            }
+            
+            EnergyReport report = scheduler.energyReport(makespan);
+            long long busy = 0;
+            for (long long ms : report.pstate_ms) busy += ms;
+            double top_share = busy > 0 ? 100.0 * report.pstate_ms.back() / busy : 0.0;
+            
+            std::cout << std::fixed << std::left
+                      << std::setw(15) << MultiProcessorScheduler::placementName(placement)
+                      << std::setw(14) << EnergyModel::governorName(governor) << std::right
+                      << std::setprecision(1) << std::setw(10) << makespan / 1000.0 << "s"
+                      << std::setprecision(2) << std::setw(10) << report.throughput()
+                      << std::setprecision(0) << std::setw(12) << report.joules()
+                      << std::setprecision(2) << std::setw(8) << report.averageWatts()
+                      << std::setprecision(3) << std::setw(9) << report.joulesPerTask()
+                      << std::setw(9) << report.tasksPerJoule()
+                      << std::setprecision(0) << std::setw(9) << scheduler.snapshot().total().averageTurnaround() << "ms"
+                      << std::setw(7) << top_share << "\n";
+            std::cout.unsetf(std::ios::fixed);
+        }
+    }
+    std::cout << std::setprecision(6);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
     try {
-        std::cout << "=== MULTI-PROCESSOR SCHEDULING DEMO ===\n\n";
+        // 2 sockets, each one NUMA node with a single 2-thread SMT core
+        CPUTopology topology = CPUTopology::build(2, 1, 1, 1, 2);
+        
+        if (argc > 1 && std::string(argv[1]) == "--virtual") {
+            long long count = argc > 2 ? std::atoll(argv[2]) : 10000000;
+            unsigned seed = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 42;
+            if (count < 1) {
+                std::cerr << "Usage: " << argv[0] << " [--virtual [tasks] [seed]]\n";
+                return 1;
+            }
+            
+            std::cout << "=== VIRTUAL-TIME MULTI-PROCESSOR SIMULATION ===\n";
+            std::cout << count << " tasks, seed " << seed << "\n";
+            topology.display();
+            std::cout << "\n--- Flat (every core equidistant) ---";
+            runVirtualWorkload(topology, false, count, seed);
+            std::cout << "\n--- Topology-aware (nearest victims first) ---";
+            runVirtualWorkload(topology, true, count, seed);
+            return 0;
+        }
+        
+        if (argc > 1 && std::string(argv[1]) == "--sweep") {
+            long long count = argc > 2 ? std::atoll(argv[2]) : 200000;
+            unsigned seed = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 42;
+            std::string thresholds = argc > 4 ? argv[4] : "0:8";
+            if (count < 1) {
+                std::cerr << "Usage: " << argv[0] << " --sweep [tasks] [seed] [thresholds]\n";
+                return 1;
+            }
+            topology.display();
+            std::cout << "\n";
+            return runThresholdSweep(topology, count, seed, thresholds);
+        }
         
-        const int NUM_CORES = 4;
-        MultiProcessorScheduler scheduler(NUM_CORES);
+        if (argc > 1 && std::string(argv[1]) == "--energy") {
+            std::string source = argc > 2 ? argv[2] : "";
+            unsigned seed = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 42;
+            topology.display();
+            std::cout << "\n";
+            return runEnergyComparison(topology, source, seed);
+        }
         
-        // Start CPU schedulers
-        std::vector<std::thread> cpu_threads;
-        for (int i = 0; i < NUM_CORES; i++) {
-            cpu_threads.emplace_back(&MultiProcessorScheduler::cpuScheduler, &scheduler, i);
+        if (argc > 1 && std::string(argv[1]) == "--gang") {
+            int group_count = argc > 2 ? std::atoi(argv[2]) : 24;
+            unsigned seed = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 42;
+            if (group_count < 1) {
+                std::cerr << "Usage: " << argv[0] << " --gang [groups] [seed]\n";
+                return 1;
+            }
+            topology.display();
+            std::cout << "\n";
+            return runGangComparison(topology, group_count, seed);
         }
         
-        // Start load balancer
-        std::thread load_balancer_thread(&MultiProcessorScheduler::loadBalancer, &scheduler);
+        std::cout << "=== MULTI-PROCESSOR SCHEDULING DEMO ===\n\n";
+        
+        topology.display();
+        const int NUM_CORES = topology.size();
         
         // Generate tasks with different affinities
         std::random_device rd;
         std::mt19937 gen(rd());
         std::uniform_int_distribution<> burst_dist(50, 200);
-        std::uniform_int_distribution<> affinity_dist(0, NUM_CORES - 1);
+        // Pinned tasks all land on socket 0, so socket 1 has to steal
+        std::uniform_int_distribution<> affinity_dist(0, NUM_CORES / 2 - 1);
         
-        std::cout << "Generating tasks...\n";
+        std::cout << "\nGenerating tasks...\n";
+        std::vector<Task> workload;
         for (int i = 1; i <= 12; i++) {
             int burst_time = burst_dist(gen);
-            int preferred_cpu = (i % 3 == 0) ? affinity_dist(gen) : -1; // Some tasks have affinity
-            
-            Task task(i, burst_time, preferred_cpu);
-            scheduler.addTask(task);
-            
-            if (preferred_cpu >= 0) {
-                std::cout << "Added Task " << i << " with CPU affinity to Core " << preferred_cpu << "\n";
-            } else {
-                std::cout << "Added Task " << i << " without CPU affinity\n";
-            }
-            
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            int preferred_cpu = (i % 3 != 0) ? affinity_dist(gen) : -1; // Most tasks have affinity
+            workload.emplace_back(i, burst_time, preferred_cpu);
         }
         
-        // Wait for all tasks to complete
-        scheduler.waitForCompletion();
+        // Same workload, victims chosen without and with topology awareness
+        std::cout << "\n--- Flat (every core equidistant) ---\n";
+        runWorkload(topology, false, workload);
+        
+        std::cout << "\n--- Topology-aware (nearest victims first) ---\n";
+        runWorkload(topology, true, workload);
         
-        scheduler.displayStats();
+        std::cout << "\n--- Topology-aware, batched submission ---\n";
+        runWorkload(topology, true, workload, true);
         
         // Demonstrate NUMA awareness
         NUMAScheduler numa_scheduler;
@@ -353,19 +1485,6 @@ int main() {
         std::cout << "\nOptimal core for NUMA node 0: " << numa_scheduler.selectOptimalCore(0) << "\n";
         std::cout << "Optimal core for NUMA node 1: " << numa_scheduler.selectOptimalCore(1) << "\n";
         
-        // Stop scheduler
-        scheduler.stop();
-        
-        if (load_balancer_thread.joinable()) {
-            load_balancer_thread.join();
-        }
-        
-        for (auto& thread : cpu_threads) {
-            if (thread.joinable()) {
-                thread.join();
-            }
-        }
-        
         std::cout << "\nMulti-processor scheduling demo completed!\n";
         
     } catch (const std::exception& e) {
@@ -374,4 +1493,4 @@ int main() {
     }
     
     return 0;
-}
\ No newline at end of file
+}
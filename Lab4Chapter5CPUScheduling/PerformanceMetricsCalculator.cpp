@@ -5,85 +5,255 @@
 #include <vector>
 #include <algorithm>
 #include <iomanip>
+#include <cmath>
+#include <random>
 
-struct Process {
-    int pid;
-    int arrival_time;
-    int burst_time;
-    int remaining_time;
-    int completion_time;
-    int turnaround_time;
-    int waiting_time;
-    int priority;
-    
-    Process(int id, int at, int bt, int pr = 0) 
-        : pid(id), arrival_time(at), burst_time(bt), 
-          remaining_time(bt), priority(pr) {}
-};
+#include "ProcessTable.h"
 
-class MetricsCalculator {
+// Welford's online mean and variance: numerically stable, O(1) per sample
+class RunningStats {
 private:
-    std::vector<Process> processes;
-    int total_time;
-    int cpu_idle_time;
+    long long n = 0;
+    double mean_value = 0.0;
+    double m2 = 0.0;
+    double min_value = 0.0;
+    double max_value = 0.0;
 
 public:
-    void setProcesses(const std::vector<Process>& procs) {
-        processes = procs;
-        calculateTotalTime();
+    void add(double x) {
+        n++;
+        double delta = x - mean_value;
+        mean_value += delta / n;
+        m2 += delta * (x - mean_value);
+        if (n == 1 || x < min_value) min_value = x;
+        if (n == 1 || x > max_value) max_value = x;
+    }
+    
+    long long count() const { return n; }
+    double mean() const { return mean_value; }
+    double variance() const { return n > 1 ? m2 / (n - 1) : 0.0; }
+    double stddev() const { return std::sqrt(variance()); }
+    double min() const { return min_value; }
+    double max() const { return max_value; }
+};
+
+// P-square quantile estimator (Jain & Chlamtac, 1985)
+// Tracks one quantile with five markers whose heights are adjusted by
+// piecewise-parabolic interpolation as samples arrive, so memory and time
+// per sample are constant no matter how long the run is.
+class P2Quantile {
+private:
+    double p;
+    long long count = 0;
+    double heights[5];
+    double positions[5];
+    double desired[5];
+    double increments[5];
+
+    double parabolic(int i, double d) const {
+        return heights[i] + d / (positions[i + 1] - positions[i - 1]) *
+            ((positions[i] - positions[i - 1] + d) * (heights[i + 1] - heights[i]) / (positions[i + 1] - positions[i]) +
+             (positions[i + 1] - positions[i] - d) * (heights[i] - heights[i - 1]) / (positions[i] - positions[i - 1]));
     }
     
-    void calculateTotalTime() {
-        if (processes.empty()) return;
+    double linear(int i, int d) const {
+        return heights[i] + d * (heights[i + d] - heights[i]) / (positions[i + d] - positions[i]);
+    }
+
+public:
+    explicit P2Quantile(double quantile) : p(quantile) {}
+    
+    void add(double x) {
+        if (count < 5) {
+            heights[count++] = x;
+            if (count == 5) {
+                std::sort(heights, heights + 5);
+                for (int i = 0; i < 5; i++) positions[i] = i + 1;
+                desired[0] = 1; desired[1] = 1 + 2 * p; desired[2] = 1 + 4 * p;
+                desired[3] = 3 + 2 * p; desired[4] = 5;
+                increments[0] = 0; increments[1] = p / 2; increments[2] = p;
+                increments[3] = (1 + p) / 2; increments[4] = 1;
+            }
+            return;
+        }
+        count++;
         
-        int max_completion = 0;
-        for (const auto& p : processes) {
-            max_completion = std::max(max_completion, p.completion_time);
+        // Find the cell holding x, extending the extremes if needed
+        int k;
+        if (x < heights[0]) {
+            heights[0] = x;
+            k = 0;
+        } else if (x >= heights[4]) {
+            heights[4] = std::max(heights[4], x);
+            k = 3;
+        } else {
+            k = 0;
+            while (x >= heights[k + 1]) k++;
+        }
+        for (int i = k + 1; i < 5; i++) positions[i]++;
+        for (int i = 0; i < 5; i++) desired[i] += increments[i];
+        
+        // Move the middle markers toward their desired positions
+        for (int i = 1; i <= 3; i++) {
+            double d = desired[i] - positions[i];
+            if ((d >= 1 && positions[i + 1] - positions[i] > 1) ||
+                (d <= -1 && positions[i - 1] - positions[i] < -1)) {
+                int step = d > 0 ? 1 : -1;
+                double candidate = parabolic(i, step);
+                if (heights[i - 1] < candidate && candidate < heights[i + 1]) {
+                    heights[i] = candidate;
+                } else {
+                    heights[i] = linear(i, step);
+                }
+                positions[i] += step;
+            }
         }
-        total_time = max_completion;
     }
     
-    double getCPUUtilization() {
-        int cpu_busy_time = total_time - cpu_idle_time;
-        return (static_cast<double>(cpu_busy_time) / total_time) * 100.0;
+    double value() const {
+        if (count == 0) return 0.0;
+        if (count < 5) {
+            // Too few samples for markers: exact order statistic
+            double sorted[5];
+            for (int i = 0; i < count; i++) {
+                int j = i;
+                for (; j > 0 && sorted[j - 1] > heights[i]; j--) sorted[j] = sorted[j - 1];
+                sorted[j] = heights[i];
+            }
+            return sorted[static_cast<int>(p * (count - 1) + 0.5)];
+        }
+        return heights[2];
     }
-    
-    double getThroughput() {
-        return static_cast<double>(processes.size()) / total_time;
+};
+
+// Mean, variance and p50/p90/p99 of one metric in bounded memory
+class StreamingDistribution {
+private:
+    RunningStats stats;
+    P2Quantile p50{0.50};
+    P2Quantile p90{0.90};
+    P2Quantile p99{0.99};
+
+public:
+    void add(double x) {
+        stats.add(x);
+        p50.add(x);
+        p90.add(x);
+        p99.add(x);
     }
     
-    double getAverageWaitingTime() {
-        int total_waiting = 0;
-        for (const auto& p : processes) {
-            total_waiting += p.waiting_time;
+    const RunningStats& summary() const { return stats; }
+    double median() const { return p50.value(); }
+    double percentile90() const { return p90.value(); }
+    double percentile99() const { return p99.value(); }
+};
+
+// Online scheduling metrics
+// Each completed process updates running sums and sketches in O(1) and the
+// process itself is not kept, so metrics stay live for unbounded runs.
+// Utilization and throughput are measured over the span from the first
+// arrival to the last completion, so a trace that starts late is not
+// charged for the idle time before it.
+class MetricsCalculator {
+private:
+    StreamingDistribution waiting;
+    StreamingDistribution turnaround;
+    StreamingDistribution response;
+    long long busy_time = 0;   // sum of bursts
+    int first_arrival = 0;     // earliest arrival
+    int total_time = 0;        // latest completion
+
+public:
+    // Record one completed process. first_run is when it was first
+    // dispatched; without it, response time is taken as the waiting time.
+    void recordCompletion(const Process& p, int first_run = -1) {
+        if (waiting.summary().count() == 0 || p.arrival_time < first_arrival) {
+            first_arrival = p.arrival_time;
         }
-        return static_cast<double>(total_waiting) / processes.size();
+        total_time = std::max(total_time, p.completion_time);
+        busy_time += p.burst_time;
+        
+        waiting.add(p.waiting_time);
+        turnaround.add(p.turnaround_time);
+        response.add(first_run >= 0 ? first_run - p.arrival_time : p.waiting_time);
     }
     
-    double getAverageTurnaroundTime() {
-        int total_turnaround = 0;
-        for (const auto& p : processes) {
-            total_turnaround += p.turnaround_time;
+    // Forget everything recorded so far
+    void reset() {
+        *this = MetricsCalculator();
+    }
+    
+    // Replace the recorded set with procs
+    void setProcesses(const std::vector<Process>& procs) {
+        reset();
+        for (const auto& p : procs) {
+            recordCompletion(p);
         }
-        return static_cast<double>(total_turnaround) / processes.size();
     }
     
-    double getAverageResponseTime() {
-        // Assuming response time equals waiting time for simplicity
-        return getAverageWaitingTime();
+    long long getCompletedCount() const {
+        return waiting.summary().count();
+    }
+    
+    // Time from the first arrival to the last completion
+    int getSpan() const {
+        return getCompletedCount() > 0 ? total_time - first_arrival : 0;
+    }
+    
+    double getCPUUtilization() const {
+        if (getSpan() <= 0) return 0.0;
+        return std::min(100.0, static_cast<double>(busy_time) / getSpan() * 100.0);
+    }
+    
+    double getThroughput() const {
+        if (getSpan() <= 0) return 0.0;
+        return static_cast<double>(getCompletedCount()) / getSpan();
+    }
+    
+    double getAverageWaitingTime() const {
+        return waiting.summary().mean();
+    }
+    
+    double getAverageTurnaroundTime() const {
+        return turnaround.summary().mean();
     }
     
-    void displayMetrics() {
+    double getAverageResponseTime() const {
+        return response.summary().mean();
+    }
+    
+    const StreamingDistribution& getWaitingTime() const { return waiting; }
+    const StreamingDistribution& getTurnaroundTime() const { return turnaround; }
+    const StreamingDistribution& getResponseTime() const { return response; }
+    
+    static void displayDistribution(const char* name, const StreamingDistribution& d) {
+        std::cout << std::setw(12) << name
+                  << std::setw(10) << d.summary().mean()
+                  << std::setw(10) << d.summary().stddev()
+                  << std::setw(10) << d.median()
+                  << std::setw(10) << d.percentile90()
+                  << std::setw(10) << d.percentile99()
+                  << std::setw(10) << d.summary().max() << "\n";
+    }
+    
+    void displayMetrics() const {
         std::cout << std::fixed << std::setprecision(2);
         std::cout << "\n=== SCHEDULING METRICS ===\n";
+        std::cout << "Completed Processes: " << getCompletedCount() << "\n";
         std::cout << "CPU Utilization: " << getCPUUtilization() << "%\n";
         std::cout << "Throughput: " << getThroughput() << " processes/unit time\n";
         std::cout << "Average Waiting Time: " << getAverageWaitingTime() << " units\n";
         std::cout << "Average Turnaround Time: " << getAverageTurnaroundTime() << " units\n";
         std::cout << "Average Response Time: " << getAverageResponseTime() << " units\n";
+        std::cout << std::setw(12) << "Metric" << std::setw(10) << "Mean" << std::setw(10) << "StdDev"
+                  << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99"
+                  << std::setw(10) << "Max" << "\n";
+        displayDistribution("Waiting", waiting);
+        displayDistribution("Turnaround", turnaround);
+        displayDistribution("Response", response);
+        std::cout.unsetf(std::ios::fixed);
+        std::cout << std::setprecision(6);
     }
-    
-    void setCPUIdleTime(int idle) { cpu_idle_time = idle; }
 };
 
 // Demo usage
@@ -107,8 +277,37 @@ int main() {
     
     MetricsCalculator calc;
     calc.setProcesses(sample_processes);
-    calc.setCPUIdleTime(0);
     calc.displayMetrics();
     
+    // Streaming: an FCFS run of one million processes fed straight into the
+    // calculator, with live metrics every 250000 completions
+    std::cout << "\n=== STREAMING FCFS METRICS ===\n";
+    MetricsCalculator live;
+    std::mt19937 gen(42);
+    std::exponential_distribution<> gap_dist(0.9 / 25.5);
+    std::uniform_int_distribution<> burst_dist(1, 50);
+    double arrival = 0.0;
+    int clock = 0;
+    for (int pid = 1; pid <= 1000000; pid++) {
+        arrival += gap_dist(gen);
+        Process p(pid, static_cast<int>(arrival), burst_dist(gen));
+        int start = std::max(clock, p.arrival_time);
+        clock = start + p.burst_time;
+        p.completion_time = clock;
+        p.turnaround_time = p.completion_time - p.arrival_time;
+        p.waiting_time = p.turnaround_time - p.burst_time;
+        live.recordCompletion(p, start);
+        
+        if (pid % 250000 == 0) {
+            std::cout << std::fixed << std::setprecision(2)
+                      << pid << " done: utilization " << live.getCPUUtilization()
+                      << "%, mean wait " << live.getAverageWaitingTime()
+                      << ", p99 wait " << live.getWaitingTime().percentile99() << "\n";
+            std::cout.unsetf(std::ios::fixed);
+            std::cout << std::setprecision(6);
+        }
+    }
+    live.displayMetrics();
+    
     return 0;
-}
\ No newline at end of file
+}
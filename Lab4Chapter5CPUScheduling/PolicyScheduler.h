@@ -0,0 +1,350 @@
+// File: PolicyScheduler.h
+// Single-CPU scheduler core assembled from a ready queue, a selection policy
+// and a preemption policy at compile time
+
+#ifndef POLICY_SCHEDULER_H
+#define POLICY_SCHEDULER_H
+
+#include <vector>
+#include <deque>
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+#include "ProcessTable.h"
+
+// One ready process: dispatched in (key, order) order. order is the index
+// for policies that break ties like the scan-based algorithms, or an
+// enqueue sequence number for FIFO ties (round robin within a key).
+struct ReadyEntry {
+    long long key;
+    long long order;
+    int index;
+
+    bool operator>(const ReadyEntry& other) const {
+        return key != other.key ? key > other.key : order > other.order;
+    }
+};
+
+// ---- Ready queues ----
+// push(entry), pop() -> entry, empty(). ORDERS_KEYS says whether the queue
+// honours key at all; ORDERS_TIES whether it also sorts equal keys by order.
+
+// Binary min-heap: any key, any tie order
+class HeapQueue {
+public:
+    static constexpr bool ORDERS_KEYS = true;
+    static constexpr bool ORDERS_TIES = true;
+
+    void push(const ReadyEntry& entry) { heap.push(entry); }
+    const ReadyEntry& top() const { return heap.top(); }
+    ReadyEntry pop() {
+        ReadyEntry top = heap.top();
+        heap.pop();
+        return top;
+    }
+    bool empty() const { return heap.empty(); }
+    void clear() { heap = decltype(heap)(); }
+
+private:
+    std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>> heap;
+};
+
+// Plain FIFO: ignores keys and keeps only indices, O(1)
+class FifoQueue {
+public:
+    static constexpr bool ORDERS_KEYS = false;
+    static constexpr bool ORDERS_TIES = false;
+
+    void push(const ReadyEntry& entry) { fifo.push_back(entry.index); }
+    ReadyEntry pop() {
+        int front = fifo.front();
+        fifo.pop_front();
+        return {0, 0, front};
+    }
+    bool empty() const { return fifo.empty(); }
+    void clear() { fifo.clear(); }
+
+private:
+    std::deque<int> fifo;
+};
+
+// One FIFO per key for keys in [MIN_KEY, MIN_KEY + LEVELS) (priority
+// levels): O(1) push, pop scans up from the lowest non-empty level. Keys
+// outside that window go to an overflow heap, and pop takes whichever front
+// comes first, so any key is ordered correctly and only the out-of-window
+// ones pay O(log n).
+class BucketQueue {
+public:
+    static constexpr bool ORDERS_KEYS = true;
+    static constexpr bool ORDERS_TIES = false;
+    static constexpr long long MIN_KEY = -128;
+    static constexpr size_t LEVELS = 256;
+
+    void push(const ReadyEntry& entry) {
+        if (entry.key < MIN_KEY || entry.key >= MIN_KEY + static_cast<long long>(LEVELS)) {
+            overflow.push(entry);
+            return;
+        }
+        size_t level = static_cast<size_t>(entry.key - MIN_KEY);
+        if (level >= buckets.size()) buckets.resize(level + 1);
+        buckets[level].push_back(entry);
+        lowest = std::min(lowest, level);
+        count++;
+    }
+    ReadyEntry pop() {
+        if (count == 0) return overflow.pop();
+        while (buckets[lowest].empty()) lowest++;
+        if (!overflow.empty() && buckets[lowest].front() > overflow.top()) return overflow.pop();
+        ReadyEntry front = buckets[lowest].front();
+        buckets[lowest].pop_front();
+        count--;
+        return front;
+    }
+    bool empty() const { return count == 0 && overflow.empty(); }
+    void clear() {
+        for (auto& bucket : buckets) bucket.clear();
+        overflow.clear();
+        lowest = SIZE_MAX;
+        count = 0;
+    }
+
+private:
+    std::vector<std::deque<ReadyEntry>> buckets;
+    HeapQueue overflow;
+    size_t lowest = SIZE_MAX;
+    size_t count = 0; // entries in buckets
+};
+
+// ---- Selection policies ----
+// key(burst, priority, remaining, ready_since): smaller runs first. Keys are
+// fixed when a process is queued. FIFO_TIES picks enqueue order over index
+// order.
+
+struct FirstCome {
+    static constexpr bool FIFO_TIES = true;
+    long long key(int, int, int, int) const { return 0; }
+};
+
+struct ShortestJob {
+    static constexpr bool FIFO_TIES = false;
+    long long key(int burst, int, int, int) const { return burst; }
+};
+
+struct ShortestRemaining {
+    static constexpr bool FIFO_TIES = false;
+    long long key(int, int, int remaining, int) const { return remaining; }
+};
+
+// Lower number = higher priority
+struct ByPriority {
+    static constexpr bool FIFO_TIES = false;
+    long long key(int, int priority, int, int) const { return priority; }
+};
+
+// Same keys, but equal keys take turns in queue order - with a time quantum
+// this is round robin within each key
+template <typename Base>
+struct FifoTies : Base {
+    static constexpr bool FIFO_TIES = true;
+    using Base::Base;
+};
+
+// Linear aging on top of another policy: every rate units spent waiting
+// lower the effective key by one. The effective key base - (now - since) / rate
+// orders like base * rate + since, since the now term is common to every
+// queued process, so the key is still fixed at enqueue time and a plain heap
+// stays valid.
+template <typename Base>
+struct Aging {
+    static constexpr bool FIFO_TIES = Base::FIFO_TIES;
+    Base base;
+    int rate;
+
+    explicit Aging(int rate_units = 10, Base b = Base()) : base(b), rate(std::max(rate_units, 1)) {}
+
+    long long key(int burst, int priority, int remaining, int ready_since) const {
+        return base.key(burst, priority, remaining, ready_since) * rate + ready_since;
+    }
+};
+
+// ---- Preemption policies ----
+// slice(remaining, now, next_arrival): how long the picked process runs
+// before it is requeued; next_arrival is INT_MAX once every process arrived.
+
+struct NonPreemptive {
+    int slice(int remaining, int, int) const { return remaining; }
+};
+
+struct TimeQuantum {
+    int quantum;
+    explicit TimeQuantum(int q = 2) : quantum(std::max(q, 1)) {}
+    int slice(int remaining, int, int) const { return std::min(quantum, remaining); }
+};
+
+// Preempt whenever a process arrives so the selection policy can re-decide
+struct OnArrival {
+    int slice(int remaining, int now, int next_arrival) const {
+        return next_arrival == INT_MAX ? remaining : std::min(remaining, next_arrival - now);
+    }
+};
+
+// ---- Process stores ----
+// What the event loop reads and writes, by process index: a vector of
+// Process records, or the columns of a ProcessTable
+
+class ProcessRows {
+public:
+    explicit ProcessRows(std::vector<Process>& p) : processes(p) {}
+
+    int size() const { return static_cast<int>(processes.size()); }
+    int arrival(int i) const { return processes[i].arrival_time; }
+    int burst(int i) const { return processes[i].burst_time; }
+    int priority(int i) const { return processes[i].priority; }
+
+    void finish(int i, int completion) {
+        Process& p = processes[i];
+        p.completion_time = completion;
+        p.turnaround_time = completion - p.arrival_time;
+        p.waiting_time = p.turnaround_time - p.burst_time;
+    }
+
+private:
+    std::vector<Process>& processes;
+};
+
+class ProcessColumns {
+public:
+    explicit ProcessColumns(ProcessTable& t) : table(t) {}
+
+    int size() const { return static_cast<int>(table.size()); }
+    int arrival(int i) const { return table.arrival_time[i]; }
+    int burst(int i) const { return table.burst_time[i]; }
+    int priority(int i) const { return table.priority[i]; }
+
+    void finish(int i, int completion) {
+        table.completion_time[i] = completion;
+        table.turnaround_time[i] = completion - table.arrival_time[i];
+        table.waiting_time[i] = table.turnaround_time[i] - table.burst_time[i];
+    }
+
+private:
+    ProcessTable& table;
+};
+
+// The event loop shared by every combination: jump to the next arrival when
+// idle, dispatch the best entry for one slice, admit whatever arrived during
+// the slice ahead of the requeued process, and do the completion bookkeeping
+// in one place. Every policy call is on a concrete type, so each combination
+// compiles into its own inlined loop, once per process store. A scheduler
+// object keeps its scratch buffers between runs.
+template <typename ReadyQueue, typename Selection, typename Preemption>
+class PolicyScheduler {
+    static_assert(ReadyQueue::ORDERS_KEYS || std::is_same<Selection, FirstCome>::value,
+                  "a FIFO ready queue can only serve first-come selection");
+    static_assert(ReadyQueue::ORDERS_TIES || Selection::FIFO_TIES,
+                  "this ready queue keeps equal keys in FIFO order only");
+
+public:
+    explicit PolicyScheduler(Selection s = Selection(), Preemption p = Preemption())
+        : selection(s), preemption(p) {}
+
+    // Fills in completion, turnaround and waiting times
+    void schedule(std::vector<Process>& processes) {
+        ProcessRows rows(processes);
+        run(rows);
+    }
+
+    // Same, reading and writing the table's columns in place
+    void schedule(ProcessTable& table) {
+        ProcessColumns columns(table);
+        run(columns);
+    }
+
+private:
+    Selection selection;
+    Preemption preemption;
+    ReadyQueue ready;
+    std::vector<int> remaining_time;
+    std::vector<int> arrival_order;
+
+    template <typename Store>
+    void run(Store& processes) {
+        const int n = processes.size();
+        remaining_time.resize(n);
+        arrival_order.resize(n);
+        for (int i = 0; i < n; i++) {
+            remaining_time[i] = processes.burst(i);
+            arrival_order[i] = i;
+        }
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                  [&processes](int a, int b) {
+                      return processes.arrival(a) < processes.arrival(b);
+                  });
+        ready.clear();
+
+        int current_time = 0;
+        int next_arrival = 0; // cursor into arrival_order
+        long long sequence = 0;
+
+        auto enqueue = [&](int idx, int since) {
+            if constexpr (ReadyQueue::ORDERS_KEYS) {
+                long long order = Selection::FIFO_TIES ? sequence++ : idx;
+                long long key = selection.key(processes.burst(idx), processes.priority(idx),
+                                             remaining_time[idx], since);
+                ready.push({key, order, idx});
+            } else {
+                (void)since;
+                ready.push({0, 0, idx});
+            }
+        };
+        auto admit_arrivals = [&]() {
+            while (next_arrival < n &&
+                   processes.arrival(arrival_order[next_arrival]) <= current_time) {
+                int idx = arrival_order[next_arrival++];
+                enqueue(idx, processes.arrival(idx));
+            }
+        };
+
+        for (int completed = 0; completed < n;) {
+            if (ready.empty() &&
+                current_time < processes.arrival(arrival_order[next_arrival])) {
+                // CPU idle - jump to the next arrival
+                current_time = processes.arrival(arrival_order[next_arrival]);
+            }
+            admit_arrivals();
+
+            int current = ready.pop().index;
+            int upcoming = next_arrival < n ? processes.arrival(arrival_order[next_arrival]) : INT_MAX;
+            int run_time = preemption.slice(remaining_time[current], current_time, upcoming);
+            remaining_time[current] -= run_time;
+            current_time += run_time;
+
+            // Processes that arrived during the slice go ahead of the preempted one
+            admit_arrivals();
+
+            if (remaining_time[current] == 0) {
+                completed++;
+                processes.finish(current, current_time);
+            } else {
+                enqueue(current, current_time);
+            }
+        }
+    }
+};
+
+// Named combinations
+using FCFSPolicy = PolicyScheduler<FifoQueue, FirstCome, NonPreemptive>;
+using SJFPolicy = PolicyScheduler<HeapQueue, ShortestJob, NonPreemptive>;
+using SRTFPolicy = PolicyScheduler<HeapQueue, ShortestRemaining, OnArrival>;
+using RoundRobinPolicy = PolicyScheduler<FifoQueue, FirstCome, TimeQuantum>;
+using PriorityPolicy = PolicyScheduler<HeapQueue, ByPriority, NonPreemptive>;
+using SJFAgingPolicy = PolicyScheduler<HeapQueue, Aging<ShortestJob>, NonPreemptive>;
+// Priorities in [-128, 127] are served from O(1) buckets; any other int
+// priority is still scheduled correctly, through BucketQueue's overflow heap
+using PriorityRoundRobinPolicy = PolicyScheduler<BucketQueue, FifoTies<ByPriority>, TimeQuantum>;
+
+#endif // POLICY_SCHEDULER_H
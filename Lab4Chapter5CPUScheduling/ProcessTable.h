@@ -0,0 +1,126 @@
+// File: ProcessTable.h
+// Process record and columnar process store shared by the scheduling labs
+// (CompleteSchedulingAlgorithms.cpp, Implementation.cpp,
+// PerformanceMetricsCalculator.cpp)
+
+#ifndef PROCESS_TABLE_H
+#define PROCESS_TABLE_H
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <cstddef>
+
+struct Process {
+    int pid;
+    int arrival_time;
+    int burst_time;
+    int remaining_time;
+    int completion_time;
+    int turnaround_time;
+    int waiting_time;
+    int priority;
+
+    Process(int id, int at, int bt, int pr = 0)
+        : pid(id), arrival_time(at), burst_time(bt),
+          remaining_time(bt), completion_time(0),
+          turnaround_time(0), waiting_time(0), priority(pr) {}
+};
+
+// Structure-of-arrays process table
+// Scheduling inputs and results are kept in separate contiguous columns
+// instead of interleaved Process records, so a metric pass only streams the
+// one column it needs. PolicyScheduler reads and writes these columns
+// directly; the hand-written algorithms, MLFQ and CFS still take a
+// std::vector<Process>, and assign() copies their result in for display.
+class ProcessTable {
+public:
+    // Inputs - read by the schedulers
+    std::vector<int> pid;
+    std::vector<int> arrival_time;
+    std::vector<int> burst_time;
+    std::vector<int> priority;
+
+    // Results - written once per process on completion
+    std::vector<int> completion_time;
+    std::vector<int> turnaround_time;
+    std::vector<int> waiting_time;
+
+    size_t size() const { return pid.size(); }
+    bool empty() const { return pid.empty(); }
+
+    void reserve(size_t n) {
+        pid.reserve(n);
+        arrival_time.reserve(n);
+        burst_time.reserve(n);
+        priority.reserve(n);
+        completion_time.reserve(n);
+        turnaround_time.reserve(n);
+        waiting_time.reserve(n);
+    }
+
+    void clear() {
+        pid.clear();
+        arrival_time.clear();
+        burst_time.clear();
+        priority.clear();
+        completion_time.clear();
+        turnaround_time.clear();
+        waiting_time.clear();
+    }
+
+    void addProcess(int id, int arrival, int burst, int prio = 0) {
+        addProcess(Process(id, arrival, burst, prio));
+    }
+
+    void addProcess(const Process& p) {
+        pid.push_back(p.pid);
+        arrival_time.push_back(p.arrival_time);
+        burst_time.push_back(p.burst_time);
+        priority.push_back(p.priority);
+        completion_time.push_back(p.completion_time);
+        turnaround_time.push_back(p.turnaround_time);
+        waiting_time.push_back(p.waiting_time);
+    }
+
+    // Replace the table contents with a scheduled process vector
+    void assign(const std::vector<Process>& processes) {
+        clear();
+        reserve(processes.size());
+        for (const auto& p : processes) {
+            addProcess(p);
+        }
+    }
+
+    // Gather one row back into a Process record
+    Process row(size_t i) const {
+        Process p(pid[i], arrival_time[i], burst_time[i], priority[i]);
+        p.remaining_time = 0;
+        p.completion_time = completion_time[i];
+        p.turnaround_time = turnaround_time[i];
+        p.waiting_time = waiting_time[i];
+        return p;
+    }
+
+    // 64-bit sum of a column; std::reduce may reorder, which lets -O3 vectorize it
+    static long long sumColumn(const std::vector<int>& column) {
+        return std::reduce(column.begin(), column.end(), 0LL);
+    }
+
+    double averageWaitingTime() const {
+        if (empty()) return 0.0;
+        return static_cast<double>(sumColumn(waiting_time)) / size();
+    }
+
+    double averageTurnaroundTime() const {
+        if (empty()) return 0.0;
+        return static_cast<double>(sumColumn(turnaround_time)) / size();
+    }
+
+    int maxCompletionTime() const {
+        if (empty()) return 0;
+        return *std::max_element(completion_time.begin(), completion_time.end());
+    }
+};
+
+#endif // PROCESS_TABLE_H
@@ -0,0 +1,150 @@
+// File: realtime_scheduling_check.cpp
+// Compile: g++ -O2 -o realtime_scheduling_check realtime_scheduling_check.cpp -std=c++17
+//
+// Usage:
+//   realtime_scheduling_check [tasks=10000] [utilization=0.9] [seed=1] [--horizon N]
+//   realtime_scheduling_check --file <tasks.csv> [--horizon N]
+//
+// Pre-deployment check for a periodic task set: runs the EDF and
+// rate-monotonic admission tests, then simulates both policies and reports
+// the deadline-miss ratio and lateness distribution. CSV task sets hold one
+// "id,period,wcet[,deadline[,phase]]" row per task (a header row is skipped).
+// Generated sets use UUniFast utilizations with log-uniform periods.
+// The default horizon is ten times the longest period.
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "RealTimeScheduler.h"
+
+static bool loadTaskSet(const std::string& path, std::vector<PeriodicTask>& tasks) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        const char* cursor = line.c_str();
+        char* end = nullptr;
+        long long fields[5] = {0, 0, 0, 0, 0};
+        int parsed = 0;
+
+        for (; parsed < 5; parsed++) {
+            fields[parsed] = std::strtoll(cursor, &end, 10);
+            if (end == cursor) break;
+            cursor = (*end == ',') ? end + 1 : end;
+        }
+        if (parsed < 3 || fields[1] <= 0 || fields[2] <= 0) continue; // header, blank or malformed row
+
+        tasks.emplace_back(static_cast<int>(fields[0]), fields[1], fields[2], fields[3], fields[4]);
+    }
+    return true;
+}
+
+// UUniFast (Bini & Buttazzo): unbiased split of the total utilization.
+// WCETs are whole time units of at least 1, so each task's utilization is
+// off from its share by the rounding; that error is carried into the next
+// task instead of piling up, and only the minimum of one unit per task can
+// push the total above the target.
+static std::vector<PeriodicTask> generateTaskSet(int count, double utilization, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<> unit(0.0, 1.0);
+    std::uniform_real_distribution<> log_period(std::log(10000.0), std::log(1000000.0));
+
+    std::vector<PeriodicTask> tasks;
+    tasks.reserve(count);
+    double remaining = utilization;
+    double carry = 0.0; // utilization handed out beyond the shares so far
+    for (int i = 0; i < count; i++) {
+        double share = remaining;
+        if (i + 1 < count) {
+            double next = remaining * std::pow(unit(gen), 1.0 / (count - i - 1));
+            share = remaining - next;
+            remaining = next;
+        }
+        long long period = static_cast<long long>(std::exp(log_period(gen)));
+        long long wcet = std::max(1LL, std::llround((share - carry) * period));
+        carry += static_cast<double>(wcet) / period - share;
+        tasks.emplace_back(i + 1, period, wcet);
+    }
+    return tasks;
+}
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [tasks] [utilization] [seed] [--horizon N]\n"
+              << "       " << program << " --file <tasks.csv> [--horizon N]\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<PeriodicTask> tasks;
+    std::string file;
+    long long horizon = 0;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--file") == 0 && i + 1 < argc) {
+            file = argv[++i];
+        } else if (std::strcmp(argv[i], "--horizon") == 0 && i + 1 < argc) {
+            horizon = std::atoll(argv[++i]);
+        } else if (argv[i][0] != '-' && positional.size() < 3) {
+            positional.push_back(argv[i]);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::cout << "=== REAL-TIME SCHEDULING CHECK ===\n";
+    if (!file.empty()) {
+        if (!loadTaskSet(file, tasks)) {
+            std::cerr << "Error: cannot read task set " << file << "\n";
+            return 1;
+        }
+        std::cout << "Task set: " << file << "\n";
+    } else {
+        int count = positional.size() > 0 ? std::atoi(positional[0].c_str()) : 10000;
+        double utilization = positional.size() > 1 ? std::atof(positional[1].c_str()) : 0.9;
+        unsigned seed = positional.size() > 2 ? static_cast<unsigned>(std::atoi(positional[2].c_str())) : 1u;
+        if (count < 1 || utilization <= 0.0) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        tasks = generateTaskSet(count, utilization, seed);
+        double achieved = 0.0;
+        for (const auto& t : tasks) achieved += static_cast<double>(t.wcet) / t.period;
+        std::cout << "Generated " << count << " tasks, target utilization " << utilization
+                  << " (achieved " << achieved << "), seed " << seed << "\n";
+    }
+    if (tasks.empty()) {
+        std::cerr << "Error: empty task set\n";
+        return 1;
+    }
+
+    if (horizon <= 0) {
+        long long longest = 0;
+        for (const auto& t : tasks) longest = std::max(longest, t.phase + t.period);
+        horizon = 10 * longest;
+    }
+    std::cout << tasks.size() << " tasks, horizon " << horizon << "\n";
+
+    bool all_admitted = true;
+    for (auto policy : {RealTimeScheduler::EDF, RealTimeScheduler::RATE_MONOTONIC}) {
+        RealTimeScheduler scheduler(policy);
+        std::cout << "\n--- " << RealTimeScheduler::policyName(policy) << " ---\n";
+
+        AdmissionResult admission = scheduler.admit(tasks);
+        RealTimeScheduler::displayAdmission(admission);
+        all_admitted = all_admitted && admission.admitted;
+
+        RealTimeScheduler::Stats stats = scheduler.simulate(tasks, horizon);
+        RealTimeScheduler::displayStats(stats);
+    }
+
+    // Non-zero exit lets a deployment pipeline gate on the check
+    return all_admitted ? 0 : 2;
+}
@@ -0,0 +1,257 @@
+// File: SchedulerTelemetry.h
+// Per-core scheduler counters and latency histograms with JSON / CSV snapshots
+
+#ifndef SCHEDULER_TELEMETRY_H
+#define SCHEDULER_TELEMETRY_H
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+
+#include "CPUTopology.h"
+
+// HDR-style log-linear histogram: exact below 32, then 16 linear buckets per
+// power of two, so any recorded value is reported within ~6%. Recording is
+// one relaxed increment - no locks, no allocation - and readers may take a
+// snapshot at any time while writers keep going.
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKETS = 16;
+    static constexpr int LINEAR_LIMIT = 2 * SUB_BUCKETS;
+    static constexpr int BUCKETS = LINEAR_LIMIT + (64 - 5) * SUB_BUCKETS;
+
+    static int bucketOf(uint64_t value) {
+        if (value < LINEAR_LIMIT) return static_cast<int>(value);
+        int msb = 63 - __builtin_clzll(value);
+        int shift = msb - 4;
+        return LINEAR_LIMIT + (msb - 5) * SUB_BUCKETS +
+               static_cast<int>((value >> shift) - SUB_BUCKETS);
+    }
+
+    // Largest value that lands in a bucket
+    static uint64_t bucketUpperBound(int bucket) {
+        if (bucket < LINEAR_LIMIT) return bucket;
+        int msb = (bucket - LINEAR_LIMIT) / SUB_BUCKETS + 5;
+        uint64_t mantissa = SUB_BUCKETS + (bucket - LINEAR_LIMIT) % SUB_BUCKETS;
+        int shift = msb - 4;
+        return (mantissa << shift) + ((uint64_t(1) << shift) - 1);
+    }
+
+    void record(uint64_t value) {
+        counts[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t seen = max.load(std::memory_order_relaxed);
+        while (value > seen &&
+               !max.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+    }
+
+    struct Snapshot {
+        std::vector<uint64_t> counts = std::vector<uint64_t>(BUCKETS, 0);
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        void merge(const Snapshot& other) {
+            for (int i = 0; i < BUCKETS; i++) counts[i] += other.counts[i];
+            count += other.count;
+            sum += other.sum;
+            max = std::max(max, other.max);
+        }
+
+        double mean() const { return count > 0 ? static_cast<double>(sum) / count : 0.0; }
+
+        // Value at or below which the given fraction of samples fall
+        uint64_t percentile(double p) const {
+            if (count == 0) return 0;
+            uint64_t rank = static_cast<uint64_t>(p * count);
+            if (rank >= count) rank = count - 1;
+            uint64_t seen = 0;
+            for (int i = 0; i < BUCKETS; i++) {
+                seen += counts[i];
+                if (seen > rank) return std::min(bucketUpperBound(i), max);
+            }
+            return max;
+        }
+    };
+
+    Snapshot snapshot() const {
+        Snapshot s;
+        for (int i = 0; i < BUCKETS; i++) {
+            s.counts[i] = counts[i].load(std::memory_order_relaxed);
+            s.count += s.counts[i];
+        }
+        s.sum = sum.load(std::memory_order_relaxed);
+        s.max = max.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> counts{};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+};
+
+// Counters for one core, on cache lines of their own so cores never share a
+// line while recording. Each core mostly writes only its own slot; the
+// relaxed atomics make the occasional cross-core write (a migration landing
+// on another core) and concurrent snapshots safe.
+struct alignas(64) CoreTelemetry {
+    std::atomic<uint64_t> dispatched{0};
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> steals{0};          // tasks this core stole
+    std::atomic<uint64_t> failed_steals{0};   // steals lost to a race
+    std::atomic<uint64_t> parks{0};           // times the core went idle
+    std::atomic<uint64_t> migration_cost_ms{0};
+    std::atomic<uint64_t> turnaround_ms{0};   // sum over completed tasks
+    std::array<std::atomic<uint64_t>, CPUTopology::DISTANCE_LEVELS> migrations{}; // arriving here
+    LatencyHistogram queue_depth;             // own queue length at each dispatch
+    LatencyHistogram wait_us;                 // arrival to dispatch
+
+    static void bump(std::atomic<uint64_t>& counter, uint64_t by = 1) {
+        counter.fetch_add(by, std::memory_order_relaxed);
+    }
+};
+
+struct CoreSnapshot {
+    int core = -1; // -1 for the all-cores total
+    uint64_t dispatched = 0;
+    uint64_t completed = 0;
+    uint64_t steals = 0;
+    uint64_t failed_steals = 0;
+    uint64_t parks = 0;
+    uint64_t migration_cost_ms = 0;
+    uint64_t turnaround_ms = 0;
+    std::array<uint64_t, CPUTopology::DISTANCE_LEVELS> migrations{};
+    LatencyHistogram::Snapshot queue_depth;
+    LatencyHistogram::Snapshot wait_us;
+
+    static CoreSnapshot of(int core, const CoreTelemetry& t) {
+        CoreSnapshot s;
+        s.core = core;
+        s.dispatched = t.dispatched.load(std::memory_order_relaxed);
+        s.completed = t.completed.load(std::memory_order_relaxed);
+        s.steals = t.steals.load(std::memory_order_relaxed);
+        s.failed_steals = t.failed_steals.load(std::memory_order_relaxed);
+        s.parks = t.parks.load(std::memory_order_relaxed);
+        s.migration_cost_ms = t.migration_cost_ms.load(std::memory_order_relaxed);
+        s.turnaround_ms = t.turnaround_ms.load(std::memory_order_relaxed);
+        for (int i = 0; i < CPUTopology::DISTANCE_LEVELS; i++) {
+            s.migrations[i] = t.migrations[i].load(std::memory_order_relaxed);
+        }
+        s.queue_depth = t.queue_depth.snapshot();
+        s.wait_us = t.wait_us.snapshot();
+        return s;
+    }
+
+    void merge(const CoreSnapshot& other) {
+        dispatched += other.dispatched;
+        completed += other.completed;
+        steals += other.steals;
+        failed_steals += other.failed_steals;
+        parks += other.parks;
+        migration_cost_ms += other.migration_cost_ms;
+        turnaround_ms += other.turnaround_ms;
+        for (int i = 0; i < CPUTopology::DISTANCE_LEVELS; i++) migrations[i] += other.migrations[i];
+        queue_depth.merge(other.queue_depth);
+        wait_us.merge(other.wait_us);
+    }
+
+    uint64_t totalMigrations() const {
+        uint64_t total = 0;
+        for (uint64_t m : migrations) total += m;
+        return total;
+    }
+
+    double averageTurnaround() const {
+        return completed > 0 ? static_cast<double>(turnaround_ms) / completed : 0.0;
+    }
+};
+
+// Point-in-time view of every core, aggregated on demand
+struct TelemetrySnapshot {
+    double elapsed_seconds = 0.0;
+    std::vector<CoreSnapshot> cores;
+
+    CoreSnapshot total() const {
+        CoreSnapshot all;
+        for (const auto& core : cores) all.merge(core);
+        return all;
+    }
+
+    double stealRate(const CoreSnapshot& s) const {
+        return elapsed_seconds > 0 ? s.steals / elapsed_seconds : 0.0;
+    }
+
+    static void writeHistogramJSON(std::ostream& out, const char* name,
+                                   const LatencyHistogram::Snapshot& h) {
+        out << "\"" << name << "\":{\"count\":" << h.count
+            << ",\"mean\":" << h.mean()
+            << ",\"p50\":" << h.percentile(0.50)
+            << ",\"p90\":" << h.percentile(0.90)
+            << ",\"p99\":" << h.percentile(0.99)
+            << ",\"max\":" << h.max << "}";
+    }
+
+    void writeCoreJSON(std::ostream& out, const CoreSnapshot& s) const {
+        out << "{\"core\":";
+        if (s.core < 0) out << "\"all\""; else out << s.core;
+        out << ",\"dispatched\":" << s.dispatched
+            << ",\"completed\":" << s.completed
+            << ",\"steals\":" << s.steals
+            << ",\"failed_steals\":" << s.failed_steals
+            << ",\"steal_rate\":" << stealRate(s)
+            << ",\"parks\":" << s.parks
+            << ",\"migrations\":{";
+        for (int level = CPUTopology::SMT_SIBLING; level < CPUTopology::DISTANCE_LEVELS; level++) {
+            out << "\"" << CPUTopology::distanceName(level) << "\":" << s.migrations[level]
+                << (level + 1 < CPUTopology::DISTANCE_LEVELS ? "," : "");
+        }
+        out << "},\"migration_cost_ms\":" << s.migration_cost_ms
+            << ",\"avg_turnaround_ms\":" << s.averageTurnaround() << ",";
+        writeHistogramJSON(out, "queue_depth", s.queue_depth);
+        out << ",";
+        writeHistogramJSON(out, "wait_us", s.wait_us);
+        out << "}";
+    }
+
+    void writeJSON(std::ostream& out) const {
+        out << "{\"elapsed_s\":" << elapsed_seconds << ",\"cores\":[";
+        for (size_t i = 0; i < cores.size(); i++) {
+            if (i > 0) out << ",";
+            writeCoreJSON(out, cores[i]);
+        }
+        out << "],\"total\":";
+        writeCoreJSON(out, total());
+        out << "}\n";
+    }
+
+    // One row per core plus an "all" row; header optional so periodic
+    // snapshots can append to one file
+    void writeCSV(std::ostream& out, bool header = true) const {
+        if (header) {
+            out << "elapsed_s,core,dispatched,completed,steals,failed_steals,steal_rate,parks,"
+                   "migrations,migration_cost_ms,avg_turnaround_ms,"
+                   "queue_depth_p50,queue_depth_p99,queue_depth_max,"
+                   "wait_us_p50,wait_us_p99,wait_us_max\n";
+        }
+        auto row = [&](const CoreSnapshot& s) {
+            out << elapsed_seconds << ",";
+            if (s.core < 0) out << "all"; else out << s.core;
+            out << "," << s.dispatched << "," << s.completed
+                << "," << s.steals << "," << s.failed_steals << "," << stealRate(s)
+                << "," << s.parks << "," << s.totalMigrations() << "," << s.migration_cost_ms
+                << "," << s.averageTurnaround()
+                << "," << s.queue_depth.percentile(0.50) << "," << s.queue_depth.percentile(0.99)
+                << "," << s.queue_depth.max
+                << "," << s.wait_us.percentile(0.50) << "," << s.wait_us.percentile(0.99)
+                << "," << s.wait_us.max << "\n";
+        };
+        for (const auto& core : cores) row(core);
+        row(total());
+    }
+};
+
+#endif // SCHEDULER_TELEMETRY_H
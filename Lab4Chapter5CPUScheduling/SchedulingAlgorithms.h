@@ -0,0 +1,450 @@
+// File: SchedulingAlgorithms.h
+// Single-CPU scheduling algorithms shared by
+// CompleteSchedulingAlgorithms.cpp and SchedulingBenchmark.cpp
+
+#ifndef SCHEDULING_ALGORITHMS_H
+#define SCHEDULING_ALGORITHMS_H
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <climits>
+#include <iomanip>
+#include <functional>
+#include <utility>
+#include <chrono>
+
+#include "ProcessTable.h"
+
+// ProcessScheduler class to handle display and calculations
+class ProcessScheduler {
+public:
+    ProcessTable processes;
+    
+    void setProcesses(const std::vector<Process>& procs) {
+        processes.assign(procs);
+    }
+    
+    void displayProcesses() {
+        std::cout << std::setw(5) << "PID" 
+                  << std::setw(10) << "Arrival" 
+                  << std::setw(10) << "Burst" 
+                  << std::setw(12) << "Completion" 
+                  << std::setw(12) << "Turnaround" 
+                  << std::setw(10) << "Waiting" << "\n";
+        std::cout << std::string(60, '-') << "\n";
+        
+        for (size_t i = 0; i < processes.size(); i++) {
+            std::cout << std::setw(5) << processes.pid[i]
+                      << std::setw(10) << processes.arrival_time[i]
+                      << std::setw(10) << processes.burst_time[i]
+                      << std::setw(12) << processes.completion_time[i]
+                      << std::setw(12) << processes.turnaround_time[i]
+                      << std::setw(10) << processes.waiting_time[i] << "\n";
+        }
+    }
+    
+    double calculateAverageWaitingTime() {
+        return processes.averageWaitingTime();
+    }
+    
+    double calculateAverageTurnaroundTime() {
+        return processes.averageTurnaroundTime();
+    }
+};
+
+class SchedulingAlgorithms {
+public:
+    // FCFS Scheduling
+    static void FCFS(std::vector<Process>& processes) {
+        std::sort(processes.begin(), processes.end(), 
+                  [](const Process& a, const Process& b) {
+                      return a.arrival_time < b.arrival_time;
+                  });
+        
+        int current_time = 0;
+        for (auto& p : processes) {
+            if (current_time < p.arrival_time) {
+                current_time = p.arrival_time;
+            }
+            p.completion_time = current_time + p.burst_time;
+            p.turnaround_time = p.completion_time - p.arrival_time;
+            p.waiting_time = p.turnaround_time - p.burst_time;
+            current_time = p.completion_time;
+        }
+    }
+    
+    // SJF Non-preemptive Scheduling
+    static void SJF(std::vector<Process>& processes) {
+        int n = processes.size();
+        std::vector<bool> completed(n, false);
+        int current_time = 0;
+        int completed_count = 0;
+        
+        while (completed_count < n) {
+            int shortest_job = -1;
+            int min_burst = INT_MAX;
+            
+            for (int i = 0; i < n; i++) {
+                if (!completed[i] && processes[i].arrival_time <= current_time) {
+                    if (processes[i].burst_time < min_burst) {
+                        min_burst = processes[i].burst_time;
+                        shortest_job = i;
+                    }
+                }
+            }
+            
+            if (shortest_job == -1) {
+                current_time++;
+                continue;
+            }
+            
+            processes[shortest_job].completion_time = current_time + processes[shortest_job].burst_time;
+            processes[shortest_job].turnaround_time = processes[shortest_job].completion_time - processes[shortest_job].arrival_time;
+            processes[shortest_job].waiting_time = processes[shortest_job].turnaround_time - processes[shortest_job].burst_time;
+            
+            current_time = processes[shortest_job].completion_time;
+            completed[shortest_job] = true;
+            completed_count++;
+        }
+    }
+    
+    // SRTF (Preemptive SJF) Scheduling
+    static void SRTF(std::vector<Process>& processes) {
+        int n = processes.size();
+        std::vector<int> remaining_time(n);
+        
+        for (int i = 0; i < n; i++) {
+            remaining_time[i] = processes[i].burst_time;
+        }
+        
+        int current_time = 0;
+        int completed = 0;
+        
+        while (completed < n) {
+            int shortest = -1;
+            int min_remaining = INT_MAX;
+            
+            for (int i = 0; i < n; i++) {
+                if (processes[i].arrival_time <= current_time && 
+                    remaining_time[i] < min_remaining && remaining_time[i] > 0) {
+                    min_remaining = remaining_time[i];
+                    shortest = i;
+                }
+            }
+            
+            if (shortest == -1) {
+                current_time++;
+                continue;
+            }
+            
+            remaining_time[shortest]--;
+            current_time++;
+            
+            if (remaining_time[shortest] == 0) {
+                completed++;
+                processes[shortest].completion_time = current_time;
+                processes[shortest].turnaround_time = processes[shortest].completion_time - processes[shortest].arrival_time;
+                processes[shortest].waiting_time = processes[shortest].turnaround_time - processes[shortest].burst_time;
+            }
+        }
+    }
+
+    // SRTF (Preemptive SJF) Scheduling - event-driven
+    // Instead of ticking one time unit at a time, jump straight to the next
+    // arrival or completion. The ready heap is keyed on (remaining, index), which
+    // reproduces the tie-breaking of SRTF() above, so the results are identical.
+    static void SRTFEventDriven(std::vector<Process>& processes) {
+        int n = processes.size();
+        std::vector<int> remaining_time(n);
+        std::vector<int> arrival_order(n);
+
+        for (int i = 0; i < n; i++) {
+            remaining_time[i] = processes[i].burst_time;
+            arrival_order[i] = i;
+        }
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                  [&processes](int a, int b) {
+                      return processes[a].arrival_time < processes[b].arrival_time;
+                  });
+
+        // Min-heap of (remaining_time, index)
+        std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                            std::greater<std::pair<int, int>>> ready_heap;
+
+        int current_time = 0;
+        int completed = 0;
+        int next_arrival = 0; // cursor into arrival_order
+
+        while (completed < n) {
+            // Admit everything that has arrived by now
+            while (next_arrival < n &&
+                   processes[arrival_order[next_arrival]].arrival_time <= current_time) {
+                int idx = arrival_order[next_arrival++];
+                ready_heap.push({remaining_time[idx], idx});
+            }
+
+            if (ready_heap.empty()) {
+                // CPU idle - jump to the next arrival
+                current_time = processes[arrival_order[next_arrival]].arrival_time;
+                continue;
+            }
+
+            int shortest = ready_heap.top().second;
+            ready_heap.pop();
+
+            // Run until completion or until the next arrival may preempt us
+            int run_time = remaining_time[shortest];
+            if (next_arrival < n) {
+                run_time = std::min(run_time,
+                                    processes[arrival_order[next_arrival]].arrival_time - current_time);
+            }
+            remaining_time[shortest] -= run_time;
+            current_time += run_time;
+
+            if (remaining_time[shortest] == 0) {
+                completed++;
+                processes[shortest].completion_time = current_time;
+                processes[shortest].turnaround_time = processes[shortest].completion_time - processes[shortest].arrival_time;
+                processes[shortest].waiting_time = processes[shortest].turnaround_time - processes[shortest].burst_time;
+            } else {
+                ready_heap.push({remaining_time[shortest], shortest});
+            }
+        }
+    }
+
+    // Round Robin Scheduling
+    static void RoundRobin(std::vector<Process>& processes, int quantum) {
+        std::queue<int> ready_queue;
+        std::vector<int> remaining_time(processes.size());
+        std::vector<bool> in_queue(processes.size(), false);
+        
+        for (size_t i = 0; i < processes.size(); i++) {
+            remaining_time[i] = processes[i].burst_time;
+        }
+        
+        int current_time = 0;
+        int completed = 0;
+        
+        // Sort by arrival time for initial processing
+        std::vector<int> arrival_order(processes.size());
+        for (size_t i = 0; i < processes.size(); i++) {
+            arrival_order[i] = i;
+        }
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                  [&processes](int a, int b) {
+                      return processes[a].arrival_time < processes[b].arrival_time;
+                  });
+        
+        // Add first process if available
+        if (!processes.empty() && processes[arrival_order[0]].arrival_time <= current_time) {
+            ready_queue.push(arrival_order[0]);
+            in_queue[arrival_order[0]] = true;
+        }
+        
+        while (!ready_queue.empty() || completed < (int)processes.size()) {
+            if (ready_queue.empty()) {
+                // Find next arriving process
+                for (int idx : arrival_order) {
+                    if (remaining_time[idx] > 0 && processes[idx].arrival_time > current_time) {
+                        current_time = processes[idx].arrival_time;
+                        ready_queue.push(idx);
+                        in_queue[idx] = true;
+                        break;
+                    }
+                }
+                if (ready_queue.empty()) break; // No more processes
+            }
+            
+            int current_process = ready_queue.front();
+            ready_queue.pop();
+            in_queue[current_process] = false;
+            
+            int exec_time = std::min(quantum, remaining_time[current_process]);
+            remaining_time[current_process] -= exec_time;
+            current_time += exec_time;
+            
+            // Add newly arrived processes
+            for (int idx : arrival_order) {
+                if (!in_queue[idx] && remaining_time[idx] > 0 && 
+                    processes[idx].arrival_time <= current_time && idx != current_process) {
+                    ready_queue.push(idx);
+                    in_queue[idx] = true;
+                }
+            }
+            
+            if (remaining_time[current_process] == 0) {
+                completed++;
+                processes[current_process].completion_time = current_time;
+                processes[current_process].turnaround_time = 
+                    processes[current_process].completion_time - processes[current_process].arrival_time;
+                processes[current_process].waiting_time = 
+                    processes[current_process].turnaround_time - processes[current_process].burst_time;
+            } else {
+                ready_queue.push(current_process);
+                in_queue[current_process] = true;
+            }
+        }
+    }
+    
+    // Round Robin Scheduling - arrival cursor
+    // Each process is admitted to the ready queue exactly once by advancing a
+    // cursor over the arrival-sorted order, instead of rescanning arrival_order
+    // after every time slice. Queue order and results match RoundRobin().
+    static void RoundRobinCursor(std::vector<Process>& processes, int quantum) {
+        int n = processes.size();
+        std::vector<int> remaining_time(n);
+        std::vector<int> arrival_order(n);
+
+        for (int i = 0; i < n; i++) {
+            remaining_time[i] = processes[i].burst_time;
+            arrival_order[i] = i;
+        }
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                  [&processes](int a, int b) {
+                      return processes[a].arrival_time < processes[b].arrival_time;
+                  });
+
+        std::queue<int> ready_queue;
+        int current_time = 0;
+        int completed = 0;
+        int next_arrival = 0; // cursor into arrival_order
+
+        auto admit_arrivals = [&]() {
+            while (next_arrival < n &&
+                   processes[arrival_order[next_arrival]].arrival_time <= current_time) {
+                ready_queue.push(arrival_order[next_arrival++]);
+            }
+        };
+
+        while (completed < n) {
+            if (ready_queue.empty() &&
+                current_time < processes[arrival_order[next_arrival]].arrival_time) {
+                // CPU idle - jump to the next arrival
+                current_time = processes[arrival_order[next_arrival]].arrival_time;
+            }
+            admit_arrivals();
+
+            int current_process = ready_queue.front();
+            ready_queue.pop();
+
+            int exec_time = std::min(quantum, remaining_time[current_process]);
+            remaining_time[current_process] -= exec_time;
+            current_time += exec_time;
+
+            // Processes that arrived during the slice go ahead of the preempted one
+            admit_arrivals();
+
+            if (remaining_time[current_process] == 0) {
+                completed++;
+                processes[current_process].completion_time = current_time;
+                processes[current_process].turnaround_time =
+                    processes[current_process].completion_time - processes[current_process].arrival_time;
+                processes[current_process].waiting_time =
+                    processes[current_process].turnaround_time - processes[current_process].burst_time;
+            } else {
+                ready_queue.push(current_process);
+            }
+        }
+    }
+
+    // Quantum given as a duration: one simulation time unit is one microsecond
+    static void RoundRobinCursor(std::vector<Process>& processes, std::chrono::microseconds quantum) {
+        RoundRobinCursor(processes, static_cast<int>(quantum.count()));
+    }
+    
+    // Priority Scheduling (Non-preemptive)
+    static void PriorityScheduling(std::vector<Process>& processes) {
+        int n = processes.size();
+        std::vector<bool> completed(n, false);
+        int current_time = 0;
+        int completed_count = 0;
+        
+        while (completed_count < n) {
+            int highest_priority_job = -1;
+            int highest_priority = INT_MAX; // Lower number = higher priority
+            
+            for (int i = 0; i < n; i++) {
+                if (!completed[i] && processes[i].arrival_time <= current_time) {
+                    if (processes[i].priority < highest_priority) {
+                        highest_priority = processes[i].priority;
+                        highest_priority_job = i;
+                    }
+                }
+            }
+            
+            if (highest_priority_job == -1) {
+                current_time++;
+                continue;
+            }
+            
+            processes[highest_priority_job].completion_time = current_time + processes[highest_priority_job].burst_time;
+            processes[highest_priority_job].turnaround_time = 
+                processes[highest_priority_job].completion_time - processes[highest_priority_job].arrival_time;
+            processes[highest_priority_job].waiting_time = 
+                processes[highest_priority_job].turnaround_time - processes[highest_priority_job].burst_time;
+            
+            current_time = processes[highest_priority_job].completion_time;
+            completed[highest_priority_job] = true;
+            completed_count++;
+        }
+    }
+
+    // SJF Non-preemptive Scheduling - O(n log n)
+    // Sorts once by arrival time and keeps arrived jobs in a min-heap keyed on
+    // (burst_time, index), which matches the tie-breaking of SJF().
+    static void SJFHeap(std::vector<Process>& processes) {
+        NonPreemptiveHeap(processes, &Process::burst_time);
+    }
+
+    // Priority Scheduling (Non-preemptive) - O(n log n)
+    // Same as SJFHeap() but keyed on (priority, index), matching PriorityScheduling().
+    static void PrioritySchedulingHeap(std::vector<Process>& processes) {
+        NonPreemptiveHeap(processes, &Process::priority);
+    }
+
+private:
+    // Dispatch the arrived process with the smallest (key, index) until done
+    static void NonPreemptiveHeap(std::vector<Process>& processes, int Process::*key) {
+        int n = processes.size();
+        std::vector<int> arrival_order(n);
+        for (int i = 0; i < n; i++) {
+            arrival_order[i] = i;
+        }
+        std::sort(arrival_order.begin(), arrival_order.end(),
+                  [&processes](int a, int b) {
+                      return processes[a].arrival_time < processes[b].arrival_time;
+                  });
+
+        // Min-heap of (key, index)
+        std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                            std::greater<std::pair<int, int>>> ready_heap;
+
+        int current_time = 0;
+        int next_arrival = 0; // cursor into arrival_order
+
+        for (int completed_count = 0; completed_count < n; completed_count++) {
+            if (ready_heap.empty() &&
+                current_time < processes[arrival_order[next_arrival]].arrival_time) {
+                // CPU idle - jump to the next arrival
+                current_time = processes[arrival_order[next_arrival]].arrival_time;
+            }
+            while (next_arrival < n &&
+                   processes[arrival_order[next_arrival]].arrival_time <= current_time) {
+                int idx = arrival_order[next_arrival++];
+                ready_heap.push({processes[idx].*key, idx});
+            }
+
+            Process& p = processes[ready_heap.top().second];
+            ready_heap.pop();
+
+            p.completion_time = current_time + p.burst_time;
+            p.turnaround_time = p.completion_time - p.arrival_time;
+            p.waiting_time = p.turnaround_time - p.burst_time;
+            current_time = p.completion_time;
+        }
+    }
+};
+
+#endif // SCHEDULING_ALGORITHMS_H
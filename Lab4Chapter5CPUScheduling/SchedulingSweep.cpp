@@ -0,0 +1,190 @@
+// File: scheduling_sweep.cpp
+// Compile: g++ -O2 -o scheduling_sweep scheduling_sweep.cpp -std=c++17 -pthread
+//
+// Usage:
+//   scheduling_sweep [--trace <trace.csv|trace.bin> | --generate <count> [seed] [load]]
+//                    [--quantum SPEC] [--levels SPEC] [--boost SPEC]
+//                    [--workers N] [--csv <results.csv>]
+//
+// Sweeps MLFQ over every (quantum, levels, boost) combination of a single
+// workload and collects the results in one columnar table. Level i of a run
+// gets quantum << i; one level with boost 0 is plain Round Robin - it
+// admits tied arrivals in RoundRobinCursor's order and gives the same
+// completion times - so the RR quantum sweep is the levels=1, boost=0 slice
+// of the table. SPEC is "lo:hi[:step]" or a list "a,b,c". The default
+// grid (20 x 5 x 10) is 1000 points over a generated 20000-process trace.
+// Runs are spread over all hardware threads.
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+#include "SchedulingTrace.h"
+#include "MLFQScheduler.h"
+#include "SweepRunner.h"
+
+// Per-worker state reused from run to run
+struct SweepWorkspace {
+    std::vector<Process> processes;
+    MLFQConfig config;
+    MLFQScheduler scheduler;
+};
+
+enum SweepMetric {
+    AVG_WAITING, AVG_TURNAROUND, MAX_WAIT, STARVED_WAITS, DEMOTIONS, BOOSTS, RUN_MS
+};
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program
+              << " [--trace <trace.csv|trace.bin> | --generate <count> [seed] [load]]\n"
+              << "       [--quantum SPEC] [--levels SPEC] [--boost SPEC] [--workers N] [--csv <results.csv>]\n"
+              << "SPEC is lo:hi[:step] or a,b,c\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string trace_path;
+    long count = 20000;
+    unsigned seed = 42;
+    double load = 0.9;
+    std::string quantum_spec = "1:20";
+    std::string levels_spec = "1:5";
+    std::string boost_spec = "0,25,50,100,200,400,800,1600,3200,6400";
+    int workers = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::string csv_path;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--generate") == 0 && i + 1 < argc) {
+            count = std::atol(argv[++i]);
+            if (i + 1 < argc && argv[i + 1][0] != '-') seed = static_cast<unsigned>(std::atoi(argv[++i]));
+            if (i + 1 < argc && argv[i + 1][0] != '-') load = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--quantum") == 0 && i + 1 < argc) {
+            quantum_spec = argv[++i];
+        } else if (std::strcmp(argv[i], "--levels") == 0 && i + 1 < argc) {
+            levels_spec = argv[++i];
+        } else if (std::strcmp(argv[i], "--boost") == 0 && i + 1 < argc) {
+            boost_spec = argv[++i];
+        } else if (std::strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            workers = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    SweepAxis quantum, levels, boost;
+    if (!SweepAxis::parse("quantum", quantum_spec, quantum) ||
+        !SweepAxis::parse("levels", levels_spec, levels) ||
+        !SweepAxis::parse("boost", boost_spec, boost) ||
+        count < 1 || load <= 0.0 || workers < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    for (int v : levels.values) {
+        if (v < 1 || v > 16) {
+            std::cerr << "Error: levels must be between 1 and 16\n";
+            return 1;
+        }
+    }
+    // Level i runs quantum << i, so every quantum must still fit in an int
+    // at the deepest swept level
+    int deepest = *std::max_element(levels.values.begin(), levels.values.end()) - 1;
+    for (int q : quantum.values) {
+        if (q < 1 || (static_cast<long long>(q) << deepest) > INT_MAX) {
+            std::cerr << "Error: quantum must be between 1 and " << (INT_MAX >> deepest)
+                      << " with " << deepest + 1 << " levels\n";
+            return 1;
+        }
+    }
+
+    // The workload is loaded once and shared read-only by every worker
+    std::vector<Process> workload;
+    if (!trace_path.empty()) {
+        if (!loadTrace(trace_path, workload)) {
+            std::cerr << "Error: cannot open trace " << trace_path << "\n";
+            return 1;
+        }
+    } else {
+        TraceGenerator generator(seed, load);
+        TraceRecord record;
+        workload.reserve(count);
+        for (long i = 0; i < count; i++) {
+            generator.next(record);
+            workload.emplace_back(record.pid, record.arrival, record.burst, record.priority);
+        }
+    }
+
+    SweepGrid grid;
+    grid.add(quantum);
+    grid.add(levels);
+    grid.add(boost);
+    SweepTable table(grid, {"avg_waiting", "avg_turnaround", "max_wait", "starved_waits",
+                            "demotions", "boosts", "run_ms"});
+
+    std::cout << "=== SCHEDULING PARAMETER SWEEP ===\n";
+    std::cout << "Workload: " << (trace_path.empty() ? "generated" : trace_path)
+              << ", " << workload.size() << " processes\n";
+    std::cout << grid.size() << " grid points on " << workers << " workers\n";
+
+    auto start = std::chrono::steady_clock::now();
+    runSweep<SweepWorkspace>(grid, table, workers,
+        [&workload](SweepWorkspace& ws, const std::vector<int>& params, SweepTable& results, long long row) {
+            auto run_start = std::chrono::steady_clock::now();
+            ws.processes.assign(workload.begin(), workload.end());
+            ws.config.quantum.resize(params[1]);
+            for (int level = 0; level < params[1]; level++) ws.config.quantum[level] = params[0] << level;
+            ws.config.boost_interval = params[2];
+            ws.scheduler.configure(ws.config);
+            MLFQScheduler::Stats stats = ws.scheduler.schedule(ws.processes);
+            auto run_end = std::chrono::steady_clock::now();
+
+            long long total_waiting = 0;
+            long long total_turnaround = 0;
+            for (const auto& p : ws.processes) {
+                total_waiting += p.waiting_time;
+                total_turnaround += p.turnaround_time;
+            }
+            double n = static_cast<double>(ws.processes.size());
+            results.metric(row, AVG_WAITING) = n > 0 ? total_waiting / n : 0.0;
+            results.metric(row, AVG_TURNAROUND) = n > 0 ? total_turnaround / n : 0.0;
+            results.metric(row, MAX_WAIT) = stats.max_wait;
+            results.metric(row, STARVED_WAITS) = static_cast<double>(stats.starved_waits);
+            results.metric(row, DEMOTIONS) = static_cast<double>(stats.demotions);
+            results.metric(row, BOOSTS) = static_cast<double>(stats.boosts);
+            results.metric(row, RUN_MS) = std::chrono::duration<double, std::milli>(run_end - run_start).count();
+        });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Sweep finished in " << seconds << "s ("
+              << (seconds > 0 ? grid.size() / seconds : 0.0) << " runs/s)\n";
+    std::cout << "\nLowest average waiting time:\n  ";
+    table.displayRow(table.best(table.column("avg_waiting")));
+    std::cout << "Lowest average turnaround time:\n  ";
+    table.displayRow(table.best(table.column("avg_turnaround")));
+    std::cout << "Shortest longest wait:\n  ";
+    table.displayRow(table.best(table.column("max_wait")));
+
+    if (!csv_path.empty()) {
+        std::ofstream out(csv_path);
+        table.writeCSV(out);
+        if (!out) {
+            std::cerr << "Error: cannot write " << csv_path << "\n";
+            return 1;
+        }
+        std::cout << "\nResults written to " << csv_path << "\n";
+    } else {
+        std::cout << "\nResults (CSV):\n";
+        table.writeCSV(std::cout);
+    }
+    return 0;
+}
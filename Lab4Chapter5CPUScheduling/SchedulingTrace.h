@@ -0,0 +1,135 @@
+// File: SchedulingTrace.h
+// Process trace files (CSV or packed binary) and the synthetic workload generator
+
+#ifndef SCHEDULING_TRACE_H
+#define SCHEDULING_TRACE_H
+
+#include <fstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+
+#include "ProcessTable.h"
+
+struct TraceRecord {
+    int32_t pid;
+    int32_t arrival;
+    int32_t burst;
+    int32_t priority;
+};
+
+inline bool isBinaryTrace(const std::string& path) {
+    return path.size() >= 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+}
+
+// Streams processes out of a trace file one record at a time
+class TraceReader {
+private:
+    std::ifstream in;
+    bool binary;
+    std::string line;
+
+public:
+    explicit TraceReader(const std::string& path)
+        : in(path, std::ios::binary), binary(isBinaryTrace(path)) {}
+
+    bool isOpen() const { return in.is_open(); }
+
+    bool next(TraceRecord& record) {
+        if (binary) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&record), sizeof(record)));
+        }
+
+        while (std::getline(in, line)) {
+            const char* cursor = line.c_str();
+            char* end = nullptr;
+            long fields[4] = {0, 0, 0, 0};
+            int parsed = 0;
+
+            for (; parsed < 4; parsed++) {
+                fields[parsed] = std::strtol(cursor, &end, 10);
+                if (end == cursor) break;
+                cursor = (*end == ',') ? end + 1 : end;
+            }
+            if (parsed < 3) continue; // header, blank or malformed row
+
+            record.pid = static_cast<int32_t>(fields[0]);
+            record.arrival = static_cast<int32_t>(fields[1]);
+            record.burst = static_cast<int32_t>(fields[2]);
+            record.priority = static_cast<int32_t>(fields[3]);
+            return true;
+        }
+        return false;
+    }
+};
+
+// Synthetic workload with Poisson arrivals; load is the offered CPU
+// utilization, and values above 1 build up large runnable sets
+class TraceGenerator {
+private:
+    std::mt19937 gen;
+    std::uniform_int_distribution<> burst_dist{1, 50};
+    std::exponential_distribution<> gap_dist;           // mean burst is 25.5
+    std::uniform_int_distribution<> priority_dist{0, 9};
+    double arrival = 0.0;
+    int32_t generated = 0;
+
+public:
+    TraceGenerator(unsigned seed, double load) : gen(seed), gap_dist(load / 25.5) {}
+
+    void next(TraceRecord& record) {
+        arrival += gap_dist(gen);
+        record = TraceRecord{++generated, static_cast<int32_t>(arrival),
+                             burst_dist(gen), priority_dist(gen)};
+    }
+};
+
+inline bool generateTrace(const std::string& path, long count, unsigned seed, double load) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+
+    TraceGenerator generator(seed, load);
+    bool binary = isBinaryTrace(path);
+
+    if (!binary) out << "pid,arrival,burst,priority\n";
+
+    TraceRecord record;
+    for (long i = 0; i < count; i++) {
+        generator.next(record);
+        if (binary) {
+            out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        } else {
+            out << record.pid << ',' << record.arrival << ',' << record.burst << ','
+                << record.priority << '\n';
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+// Whole trace in memory, for runs that schedule the same workload many times
+inline bool loadTrace(const std::string& path, std::vector<Process>& processes) {
+    TraceReader reader(path);
+    if (!reader.isOpen()) return false;
+
+    TraceRecord record;
+    while (reader.next(record)) {
+        processes.emplace_back(record.pid, record.arrival, record.burst, record.priority);
+    }
+    return true;
+}
+
+// Same, straight into the columns of a ProcessTable
+inline bool loadTrace(const std::string& path, ProcessTable& table) {
+    TraceReader reader(path);
+    if (!reader.isOpen()) return false;
+
+    TraceRecord record;
+    while (reader.next(record)) {
+        table.addProcess(record.pid, record.arrival, record.burst, record.priority);
+    }
+    return true;
+}
+
+#endif // SCHEDULING_TRACE_H
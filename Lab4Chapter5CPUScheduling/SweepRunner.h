@@ -0,0 +1,190 @@
+// File: SweepRunner.h
+// Parameter grids, a parallel sweep driver and a columnar results table
+
+#ifndef SWEEP_RUNNER_H
+#define SWEEP_RUNNER_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <utility>
+#include <cstdlib>
+
+// One swept parameter and the values it takes
+struct SweepAxis {
+    std::string name;
+    std::vector<int> values;
+
+    // "lo:hi[:step]" for a range, "a,b,c" for a list
+    static bool parse(const std::string& name, const std::string& spec, SweepAxis& axis) {
+        axis.name = name;
+        axis.values.clear();
+        if (spec.find(':') != std::string::npos) {
+            const char* cursor = spec.c_str();
+            char* end = nullptr;
+            long lo = std::strtol(cursor, &end, 10);
+            if (*end != ':') return false;
+            long hi = std::strtol(end + 1, &end, 10);
+            long step = (*end == ':') ? std::strtol(end + 1, &end, 10) : 1;
+            if (*end != '\0' || step <= 0 || hi < lo) return false;
+            for (long v = lo; v <= hi; v += step) axis.values.push_back(static_cast<int>(v));
+        } else {
+            const char* cursor = spec.c_str();
+            char* end = nullptr;
+            while (*cursor != '\0') {
+                long v = std::strtol(cursor, &end, 10);
+                if (end == cursor) return false;
+                axis.values.push_back(static_cast<int>(v));
+                cursor = (*end == ',') ? end + 1 : end;
+                if (*end != ',' && *end != '\0') return false;
+            }
+        }
+        return !axis.values.empty();
+    }
+};
+
+// Cartesian product of the axes; point i is decoded mixed-radix with the
+// last axis varying fastest, so no point list is ever materialized
+class SweepGrid {
+private:
+    std::vector<SweepAxis> axes;
+
+public:
+    void add(SweepAxis axis) {
+        axes.push_back(std::move(axis));
+    }
+
+    const std::vector<SweepAxis>& getAxes() const { return axes; }
+
+    long long size() const {
+        if (axes.empty()) return 0;
+        long long points = 1;
+        for (const auto& axis : axes) points *= static_cast<long long>(axis.values.size());
+        return points;
+    }
+
+    void point(long long index, std::vector<int>& values) const {
+        values.resize(axes.size());
+        for (size_t a = axes.size(); a-- > 0;) {
+            long long radix = static_cast<long long>(axes[a].values.size());
+            values[a] = axes[a].values[index % radix];
+            index /= radix;
+        }
+    }
+};
+
+// Structure-of-arrays results: one column per parameter, then one per
+// metric, all sized up front. Every row belongs to exactly one run, so
+// workers write their rows without locking.
+class SweepTable {
+private:
+    std::vector<std::string> names;
+    std::vector<std::vector<double>> columns;
+    int parameter_count;
+    long long row_count;
+
+public:
+    SweepTable(const SweepGrid& grid, const std::vector<std::string>& metrics)
+        : parameter_count(static_cast<int>(grid.getAxes().size())), row_count(grid.size()) {
+        for (const auto& axis : grid.getAxes()) names.push_back(axis.name);
+        names.insert(names.end(), metrics.begin(), metrics.end());
+        columns.assign(names.size(), std::vector<double>(row_count, 0.0));
+    }
+
+    long long rows() const { return row_count; }
+
+    int column(const std::string& name) const {
+        auto it = std::find(names.begin(), names.end(), name);
+        return it == names.end() ? -1 : static_cast<int>(it - names.begin());
+    }
+
+    // Metric m of a row; metrics are numbered in constructor order
+    double& metric(long long row, int m) { return columns[parameter_count + m][row]; }
+    double& at(long long row, int col) { return columns[col][row]; }
+    double at(long long row, int col) const { return columns[col][row]; }
+
+    const std::vector<double>& getColumn(int col) const { return columns[col]; }
+
+    // Row with the smallest value in a column
+    long long best(int col) const {
+        const auto& values = columns[col];
+        return std::min_element(values.begin(), values.end()) - values.begin();
+    }
+
+    void writeCSV(std::ostream& out) const {
+        for (size_t c = 0; c < names.size(); c++) {
+            out << names[c] << (c + 1 < names.size() ? "," : "\n");
+        }
+        for (long long r = 0; r < row_count; r++) {
+            for (size_t c = 0; c < columns.size(); c++) {
+                out << columns[c][r] << (c + 1 < columns.size() ? "," : "\n");
+            }
+        }
+    }
+
+    void displayRow(long long row) const {
+        for (size_t c = 0; c < names.size(); c++) {
+            std::cout << names[c] << "=" << columns[c][row] << (c + 1 < names.size() ? ", " : "\n");
+        }
+    }
+};
+
+// Runs every grid point once on a pool of worker threads. Each worker
+// builds one Workspace and hands it to every run it takes, so buffers grown
+// by the first run are reused by the rest. run(workspace, params, table, row)
+// fills the metric columns of its row; the parameter columns are filled
+// here. Points are claimed one at a time from a shared counter, which keeps
+// workers busy when run times vary across the grid. The first exception
+// thrown by a run stops the sweep and is rethrown to the caller.
+template <typename Workspace, typename Run>
+void runSweep(const SweepGrid& grid, SweepTable& table, int workers, Run run) {
+    const long long points = grid.size();
+    const int parameters = static_cast<int>(grid.getAxes().size());
+    workers = static_cast<int>(std::max(1LL, std::min<long long>(workers, points)));
+
+    std::atomic<long long> next_point{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::atomic_flag error_claimed = ATOMIC_FLAG_INIT;
+
+    auto worker = [&]() {
+        Workspace workspace;
+        std::vector<int> params;
+        for (;;) {
+            long long row = next_point.fetch_add(1, std::memory_order_relaxed);
+            if (row >= points || failed.load(std::memory_order_relaxed)) return;
+            grid.point(row, params);
+            for (int p = 0; p < parameters; p++) table.at(row, p) = params[p];
+            try {
+                run(workspace, params, table, row);
+            } catch (...) {
+                if (!error_claimed.test_and_set()) error = std::current_exception();
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < workers; i++) threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads) t.join();
+
+    if (error) std::rethrow_exception(error);
+}
+
+// For runs that build all of their state fresh: run(params, table, row)
+template <typename Run>
+void runSweep(const SweepGrid& grid, SweepTable& table, int workers, Run run) {
+    struct NoWorkspace {};
+    runSweep<NoWorkspace>(grid, table, workers,
+        [&run](NoWorkspace&, const std::vector<int>& params, SweepTable& results, long long row) {
+            run(params, results, row);
+        });
+}
+
+#endif // SWEEP_RUNNER_H
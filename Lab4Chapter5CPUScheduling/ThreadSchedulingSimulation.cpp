@@ -11,6 +11,10 @@
 #include <atomic>
 #include <algorithm>
 #include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 
 class ThreadInfo {
 public:
@@ -20,6 +24,11 @@ public:
     std::chrono::steady_clock::time_point arrival_time;
     std::chrono::steady_clock::time_point start_time;
     std::chrono::steady_clock::time_point completion_time;
+    // Real work submitted through ThreadScheduler::submit(); returns false if
+    // the job was cancelled before it started. Empty for simulated threads,
+    // which just sleep for burst_time * 100ms.
+    std::function<bool()> job;
+    unsigned long long sequence = 0; // submission order, breaks priority ties
     
     ThreadInfo(int id, int prio, int burst) 
         : thread_id(id), priority(prio), burst_time(burst) {
@@ -31,94 +40,180 @@ public:
     
     // Assignment operator
     ThreadInfo& operator=(const ThreadInfo& other) = default;
+    
+    // Move constructor and assignment, so heap moves don't copy the job
+    ThreadInfo(ThreadInfo&& other) = default;
+    ThreadInfo& operator=(ThreadInfo&& other) = default;
 };
 
 // Custom comparator for priority queue
 struct ThreadComparator {
     bool operator()(const ThreadInfo& a, const ThreadInfo& b) const {
+        return runsAfter(a.priority, a.sequence, b.priority, b.sequence);
+    }
+    
+    // The same order on the key fields alone
+    static bool runsAfter(int a_priority, unsigned long long a_sequence,
+                          int b_priority, unsigned long long b_sequence) {
         // Higher priority number = higher priority (reverse comparison for max heap)
-        return a.priority < b.priority;
+        if (a_priority != b_priority) return a_priority < b_priority;
+        // Equal priority runs in submission order
+        return a_sequence > b_sequence;
     }
 };
 
+// Thrown through the future of a job cancelled before it started
+class TaskCancelled : public std::runtime_error {
+public:
+    TaskCancelled() : std::runtime_error("task cancelled before it started") {}
+};
+
+// Result of ThreadScheduler::submit(): the future plus a cancel switch
+template <typename R>
+class JobHandle {
+public:
+    enum State { PENDING, RUNNING, CANCELLED };
+    
+    struct Shared {
+        std::atomic<int> state{PENDING};
+        std::promise<R> promise;
+    };
+    
+    JobHandle(std::shared_ptr<Shared> s, std::future<R> f)
+        : shared(std::move(s)), result(std::move(f)) {}
+    
+    // Cancels a job that has not started yet; its future then throws
+    // TaskCancelled at once. Jobs already running are left alone.
+    bool cancel() {
+        int expected = PENDING;
+        if (!shared->state.compare_exchange_strong(expected, CANCELLED)) return false;
+        shared->promise.set_exception(std::make_exception_ptr(TaskCancelled()));
+        return true;
+    }
+    
+    std::future<R>& future() { return result; }
+    R get() { return result.get(); }
+    
+private:
+    std::shared_ptr<Shared> shared;
+    std::future<R> result;
+};
+
+// Priority thread pool. Each worker owns a ThreadComparator heap behind its
+// own mutex, so submitters and workers rarely meet on the same lock. Jobs
+// submitted from a worker stay on its queue; other submissions are dealt
+// round-robin. An idle worker steals the best job among the other workers'
+// queue tops, so priority order is exact with one worker and approximate
+// (per worker, plus best-first stealing) with several.
 class ThreadScheduler {
 private:
-    std::priority_queue<ThreadInfo, std::vector<ThreadInfo>, ThreadComparator> ready_queue;
-    std::mutex queue_mutex;
+    struct alignas(64) WorkerQueue {
+        std::priority_queue<ThreadInfo, std::vector<ThreadInfo>, ThreadComparator> ready_queue;
+        std::mutex queue_mutex;
+    };
+    
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    
+    // Idle workers sleep here until a job is queued
+    std::mutex idle_mutex;
     std::condition_variable cv;
+    std::atomic<int> queued_jobs{0};
+    std::atomic<int> sleeping_workers{0};
+    
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    
     std::atomic<bool> running{true};
+    std::atomic<unsigned long long> next_sequence{0};
+    std::atomic<unsigned> next_queue{0};
     std::atomic<int> submitted_threads{0};
     std::atomic<int> completed_threads{0};
+    std::atomic<int> cancelled_threads{0};
+    std::atomic<int> stolen_jobs{0};
+    
+    // Which pool and worker the calling thread belongs to, if any
+    static thread_local const ThreadScheduler* current_pool;
+    static thread_local int current_worker;
     
 public:
-    ThreadScheduler() = default;
+    explicit ThreadScheduler(int num_workers = 1) {
+        num_workers = std::max(num_workers, 1);
+        for (int i = 0; i < num_workers; i++) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (int i = 0; i < num_workers; i++) {
+            workers.emplace_back(&ThreadScheduler::workerLoop, this, i);
+        }
+    }
+    
+    ~ThreadScheduler() {
+        stop();
+    }
+    
+    ThreadScheduler(const ThreadScheduler&) = delete;
+    ThreadScheduler& operator=(const ThreadScheduler&) = delete;
     
+    // Queue a simulated thread (no job: sleeps for its burst time)
     void addThread(const ThreadInfo& thread_info) {
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex);
-            ready_queue.push(thread_info);
-            submitted_threads++;
-        }
-        cv.notify_one();
+        ThreadInfo info = thread_info;
+        info.sequence = next_sequence++;
+        enqueue(std::move(info));
     }
     
-    void scheduler() {
-        while (true) {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            
-            // Wait until there's a thread to process or we're told to stop
-            cv.wait(lock, [this] { 
-                return !ready_queue.empty() || !running.load(); 
-            });
-            
-            // Check if we should exit
-            if (!running.load() && ready_queue.empty()) {
-                break;
+    // Run a callable on the pool at the given priority
+    template <typename F>
+    JobHandle<std::invoke_result_t<F>> submit(int priority, F&& fn) {
+        using R = std::invoke_result_t<F>;
+        auto shared = std::make_shared<typename JobHandle<R>::Shared>();
+        std::future<R> future = shared->promise.get_future();
+        
+        ThreadInfo info(0, priority, 0);
+        info.sequence = next_sequence++;
+        info.thread_id = static_cast<int>(info.sequence) + 1;
+        info.job = [shared, fn = std::forward<F>(fn)]() mutable {
+            int expected = JobHandle<R>::PENDING;
+            if (!shared->state.compare_exchange_strong(expected, JobHandle<R>::RUNNING)) {
+                return false; // cancelled; the future already holds TaskCancelled
             }
-            
-            if (!ready_queue.empty()) {
-                ThreadInfo current_thread = ready_queue.top();
-                ready_queue.pop();
-                lock.unlock();
-                
-                // Simulate thread execution
-                current_thread.start_time = std::chrono::steady_clock::now();
-                std::cout << "Executing Thread " << current_thread.thread_id 
-                          << " (Priority: " << current_thread.priority << ")\n";
-                
-                std::this_thread::sleep_for(std::chrono::milliseconds(current_thread.burst_time * 100));
-                
-                current_thread.completion_time = std::chrono::steady_clock::now();
-                
-                auto turnaround_time = std::chrono::duration_cast<std::chrono::milliseconds>
-                    (current_thread.completion_time - current_thread.arrival_time);
-                
-                std::cout << "Thread " << current_thread.thread_id 
-                          << " completed. Turnaround time: " << turnaround_time.count() << "ms\n";
-                
-                // Update completed counter
-                completed_threads++;
-                
-                // Notify waiters
-                cv.notify_all();
+            try {
+                if constexpr (std::is_void_v<R>) {
+                    fn();
+                    shared->promise.set_value();
+                } else {
+                    shared->promise.set_value(fn());
+                }
+            } catch (...) {
+                shared->promise.set_exception(std::current_exception());
             }
-        }
-        std::cout << "Scheduler stopped. Total threads completed: " << completed_threads.load() << "\n";
+            return true;
+        };
+        enqueue(std::move(info));
+        return JobHandle<R>(std::move(shared), std::move(future));
     }
     
+    // Drains every queued job, then joins the workers
     void stop() {
-        running.store(false);
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex);
+            if (!running.load()) return;
+            running.store(false);
+        }
         cv.notify_all();
+        for (auto& worker : workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        std::cout << "Scheduler stopped. Total threads completed: " << completed_threads.load() << "\n";
     }
     
     void waitForCompletion() {
-        // Simple busy wait with short sleeps to avoid deadlock
-        while (completed_threads.load() < submitted_threads.load()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
-        
-        // Give a bit more time to ensure all output is flushed
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        // Cancelled jobs count as finished once a worker discards them
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [this] {
+            return completed_threads.load() + cancelled_threads.load() >= submitted_threads.load();
+        });
     }
     
     int getCompletedThreadsCount() const {
@@ -128,8 +223,162 @@ public:
     int getSubmittedThreadsCount() const {
         return submitted_threads.load();
     }
+    
+    int getCancelledThreadsCount() const {
+        return cancelled_threads.load();
+    }
+    
+    int getStolenJobsCount() const {
+        return stolen_jobs.load();
+    }
+    
+    int getWorkerCount() const {
+        return static_cast<int>(workers.size());
+    }
+    
+private:
+    void enqueue(ThreadInfo info) {
+        int target;
+        if (current_pool == this) {
+            target = current_worker;
+        } else {
+            target = static_cast<int>(next_queue++ % queues.size());
+        }
+        submitted_threads++;
+        {
+            std::lock_guard<std::mutex> lock(queues[target]->queue_mutex);
+            queues[target]->ready_queue.push(std::move(info));
+        }
+        queued_jobs++;
+        // A worker counts itself as sleeping before it checks queued_jobs, and
+        // both counters are sequentially consistent, so either it sees this
+        // job or we see it sleeping. Only then is idle_mutex worth taking: it
+        // orders the notify after the sleeper's predicate check.
+        if (sleeping_workers.load() > 0) {
+            { std::lock_guard<std::mutex> lock(idle_mutex); }
+            cv.notify_one();
+        }
+    }
+    
+    // Moves the top job out of a queue whose mutex the caller holds
+    static void takeTop(WorkerQueue& q, ThreadInfo& info) {
+        // top() is const only to protect the heap order; the element is
+        // popped right after and the comparator reads only ints, which a
+        // move leaves in place
+        info = std::move(const_cast<ThreadInfo&>(q.ready_queue.top()));
+        q.ready_queue.pop();
+    }
+    
+    bool popLocal(int worker_id, ThreadInfo& info) {
+        WorkerQueue& q = *queues[worker_id];
+        std::lock_guard<std::mutex> lock(q.queue_mutex);
+        if (q.ready_queue.empty()) return false;
+        takeTop(q, info);
+        queued_jobs--;
+        return true;
+    }
+    
+    // Take the highest-priority job among the other workers' queue tops
+    bool stealJob(int worker_id, ThreadInfo& info) {
+        const int n = static_cast<int>(queues.size());
+        for (int attempt = 0; attempt < 2; attempt++) {
+            // The scan only compares keys; the job itself is moved once, below
+            int victim = -1;
+            int best_priority = 0;
+            unsigned long long best_sequence = 0;
+            for (int k = 1; k < n; k++) {
+                int i = (worker_id + k) % n;
+                std::lock_guard<std::mutex> lock(queues[i]->queue_mutex);
+                if (queues[i]->ready_queue.empty()) continue;
+                const ThreadInfo& top = queues[i]->ready_queue.top();
+                if (victim == -1 ||
+                    ThreadComparator::runsAfter(best_priority, best_sequence, top.priority, top.sequence)) {
+                    best_priority = top.priority;
+                    best_sequence = top.sequence;
+                    victim = i;
+                }
+            }
+            if (victim == -1) return false;
+            
+            // The top may have changed since we looked; take whatever is there now
+            WorkerQueue& q = *queues[victim];
+            std::lock_guard<std::mutex> lock(q.queue_mutex);
+            if (q.ready_queue.empty()) continue;
+            takeTop(q, info);
+            queued_jobs--;
+            stolen_jobs++;
+            return true;
+        }
+        return false;
+    }
+    
+    void workerLoop(int worker_id) {
+        current_pool = this;
+        current_worker = worker_id;
+        ThreadInfo current_thread(0, 0, 0);
+        
+        while (true) {
+            if (popLocal(worker_id, current_thread) || stealJob(worker_id, current_thread)) {
+                execute(current_thread);
+                continue;
+            }
+            
+            std::unique_lock<std::mutex> lock(idle_mutex);
+            sleeping_workers++;
+            // Wait until there's a thread to process or we're told to stop
+            cv.wait(lock, [this] { 
+                return queued_jobs.load() > 0 || !running.load(); 
+            });
+            sleeping_workers--;
+            
+            // Check if we should exit
+            if (!running.load() && queued_jobs.load() == 0) {
+                break;
+            }
+        }
+        current_pool = nullptr;
+    }
+    
+    void execute(ThreadInfo& current_thread) {
+        current_thread.start_time = std::chrono::steady_clock::now();
+        
+        bool ran = true;
+        if (current_thread.job) {
+            ran = current_thread.job();
+        } else {
+            // Simulate thread execution
+            std::cout << "Executing Thread " << current_thread.thread_id 
+                      << " (Priority: " << current_thread.priority << ")\n";
+            
+            std::this_thread::sleep_for(std::chrono::milliseconds(current_thread.burst_time * 100));
+        }
+        
+        current_thread.completion_time = std::chrono::steady_clock::now();
+        
+        if (!current_thread.job) {
+            auto turnaround_time = std::chrono::duration_cast<std::chrono::milliseconds>
+                (current_thread.completion_time - current_thread.arrival_time);
+            
+            std::cout << "Thread " << current_thread.thread_id 
+                      << " completed. Turnaround time: " << turnaround_time.count() << "ms\n";
+        }
+        
+        // Update completed counter
+        if (ran) {
+            completed_threads++;
+        } else {
+            cancelled_threads++;
+        }
+        
+        // Notify waiters
+        { std::lock_guard<std::mutex> lock(done_mutex); }
+        done_cv.notify_all();
+    }
 };
 
+thread_local const ThreadScheduler* ThreadScheduler::current_pool = nullptr;
+thread_local int ThreadScheduler::current_worker = -1;
+
 // Pthread-style thread attributes simulation with custom enum names
 class ThreadAttributes {
 public:
@@ -161,6 +410,60 @@ void workerThread(int id, int work_time) {
     std::cout << "Worker Thread " << id << " completed work\n";
 }
 
+// Counts primes below limit by trial division - a real CPU-bound job
+long long countPrimes(int limit) {
+    long long count = 0;
+    for (int n = 2; n < limit; n++) {
+        bool prime = true;
+        for (int d = 2; d * d <= n; d++) {
+            if (n % d == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) count++;
+    }
+    return count;
+}
+
+// Runs CPU-bound jobs through the same priority policy on every hardware thread
+void runExecutorDemo() {
+    int num_workers = std::max(1u, std::thread::hardware_concurrency());
+    ThreadScheduler pool(num_workers);
+    std::cout << "Workers: " << pool.getWorkerCount() << "\n";
+    
+    auto start = std::chrono::steady_clock::now();
+    std::vector<JobHandle<long long>> jobs;
+    for (int i = 0; i < 16; i++) {
+        int limit = 200000 + i * 20000;
+        jobs.push_back(pool.submit(i % 4, [limit] { return countPrimes(limit); }));
+    }
+    
+    // A lowest-priority job that is cancelled before a worker reaches it
+    auto doomed = pool.submit(-1, [] { return countPrimes(5000000); });
+    bool cancelled = doomed.cancel();
+    
+    long long total = 0;
+    for (auto& job : jobs) {
+        total += job.get();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    std::cout << "16 prime-counting jobs found " << total << " primes in " << seconds << "s\n";
+    try {
+        doomed.get();
+        std::cout << "Cancelled job ran anyway\n";
+    } catch (const TaskCancelled& e) {
+        std::cout << "Low-priority job " << (cancelled ? "cancelled" : "not cancelled")
+                  << ": " << e.what() << "\n";
+    }
+    
+    pool.waitForCompletion();
+    std::cout << "Completed: " << pool.getCompletedThreadsCount()
+              << ", Cancelled: " << pool.getCancelledThreadsCount()
+              << ", Stolen between workers: " << pool.getStolenJobsCount() << "\n";
+}
+
 int main() {
     try {
         std::cout << "=== THREAD SCHEDULING DEMONSTRATION ===\n\n";
@@ -174,10 +477,8 @@ int main() {
         
         std::cout << "\n=== THREAD SCHEDULER SIMULATION ===\n";
         
-        ThreadScheduler scheduler;
-        
-        // Start scheduler in separate thread
-        std::thread scheduler_thread(&ThreadScheduler::scheduler, &scheduler);
+        // One worker: simulated threads run in strict priority order
+        ThreadScheduler scheduler(1);
         
         // Create and schedule threads with different priorities
         scheduler.addThread(ThreadInfo(1, 3, 5));  // Medium priority
@@ -188,11 +489,11 @@ int main() {
         // Wait for all threads to complete properly
         scheduler.waitForCompletion();
         
-        // Stop the scheduler and wait for scheduler thread to finish
+        // Stop the scheduler and join its worker
         scheduler.stop();
-        if (scheduler_thread.joinable()) {
-            scheduler_thread.join();
-        }
+        
+        std::cout << "\n=== THREAD POOL EXECUTOR ===\n";
+        runExecutorDemo();
         
         std::cout << "\n=== PTHREAD STYLE THREADS ===\n";
         
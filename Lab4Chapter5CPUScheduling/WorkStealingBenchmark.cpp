@@ -0,0 +1,167 @@
+// File: work_stealing_benchmark.cpp
+// Compile: g++ -O2 -o work_stealing_benchmark work_stealing_benchmark.cpp -std=c++17 -pthread
+//
+// Usage: work_stealing_benchmark [max_threads] [items]
+//
+// One owner thread pushes items onto its queue and pops them back while every
+// other thread steals from the top, the access pattern of a busy CPUCore being
+// drained by idle cores. The lock-free Chase-Lev deque used by CPUCore is
+// compared with the mutex-guarded queue it replaced, at 1, 2, 4, ... threads.
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <cstdlib>
+
+#include "WorkStealingDeque.h"
+
+// The previous CPUCore design: one mutex around the whole queue
+class MutexDeque {
+private:
+    std::deque<int*> items;
+    std::mutex queue_mutex;
+
+public:
+    void push(int* value) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        items.push_back(value);
+    }
+
+    bool pop(int*& value) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (items.empty()) return false;
+        value = items.back();
+        items.pop_back();
+        return true;
+    }
+
+    bool steal(int*& value) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (items.empty()) return false;
+        value = items.front();
+        items.pop_front();
+        return true;
+    }
+
+    bool empty() {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        return items.empty();
+    }
+};
+
+struct StealResult {
+    double seconds;
+    long long popped;
+    long long stolen;
+};
+
+// Per-thread counter on its own cache line
+struct alignas(64) PaddedCounter {
+    long long value = 0;
+};
+
+template <typename Queue>
+static StealResult runStealBenchmark(int threads, long long items) {
+    static int token = 0;
+    Queue queue;
+    std::atomic<bool> start{false};
+    std::atomic<bool> done{false};
+    std::vector<PaddedCounter> stolen(threads);
+    std::vector<std::thread> thieves;
+
+    for (int i = 1; i < threads; i++) {
+        thieves.emplace_back([&, i]() {
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            int* value;
+            while (!done.load(std::memory_order_acquire)) {
+                if (queue.steal(value)) {
+                    stolen[i].value++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    const long long BATCH = 256;
+    long long popped = 0;
+    int* value;
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    for (long long pushed = 0; pushed < items;) {
+        for (long long i = 0; i < BATCH && pushed < items; i++, pushed++) {
+            queue.push(&token);
+        }
+        // Owner works through half of the batch, thieves take what they can
+        for (long long i = 0; i < BATCH / 2 && queue.pop(value); i++) {
+            popped++;
+        }
+    }
+    while (!queue.empty()) {
+        if (queue.pop(value)) popped++;
+    }
+
+    done.store(true, std::memory_order_release);
+    for (auto& t : thieves) t.join();
+    auto end = std::chrono::steady_clock::now();
+
+    long long total_stolen = 0;
+    for (const auto& counter : stolen) total_stolen += counter.value;
+
+    return {std::chrono::duration<double>(end - begin).count(), popped, total_stolen};
+}
+
+int main(int argc, char* argv[]) {
+    int max_threads = argc > 1 ? std::atoi(argv[1]) : 64;
+    long long items = argc > 2 ? std::atoll(argv[2]) : 2000000;
+    if (max_threads < 1 || items < 1) {
+        std::cerr << "Usage: " << argv[0] << " [max_threads] [items]\n";
+        return 1;
+    }
+
+    std::cout << "=== WORK STEALING BENCHMARK ===\n";
+    std::cout << items << " items per run, hardware threads: "
+              << std::thread::hardware_concurrency() << "\n\n";
+    std::cout << std::setw(8) << "Threads"
+              << std::setw(16) << "ChaseLev Mops"
+              << std::setw(16) << "Steals Mops"
+              << std::setw(10) << "Stolen%"
+              << std::setw(14) << "Mutex Mops"
+              << std::setw(16) << "Steals Mops"
+              << std::setw(10) << "Stolen%" << "\n";
+    std::cout << std::string(90, '-') << "\n";
+
+    bool all_accounted = true;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        StealResult lock_free = runStealBenchmark<WorkStealingDeque<int*>>(threads, items);
+        StealResult locked = runStealBenchmark<MutexDeque>(threads, items);
+
+        all_accounted = all_accounted &&
+                        lock_free.popped + lock_free.stolen == items &&
+                        locked.popped + locked.stolen == items;
+
+        auto report = [items](const StealResult& r, int width) {
+            std::cout << std::setw(width) << std::setprecision(2) << items / r.seconds / 1e6
+                      << std::setw(16) << r.stolen / r.seconds / 1e6
+                      << std::setw(10) << std::setprecision(1) << 100.0 * r.stolen / items;
+        };
+
+        std::cout << std::fixed << std::setw(8) << threads;
+        report(lock_free, 16);
+        report(locked, 14);
+        std::cout << "\n";
+    }
+
+    if (!all_accounted) {
+        std::cerr << "Error: items were lost or duplicated\n";
+        return 1;
+    }
+    return 0;
+}
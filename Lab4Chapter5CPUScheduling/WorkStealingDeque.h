@@ -0,0 +1,142 @@
+// File: WorkStealingDeque.h
+// Lock-free Chase-Lev work-stealing deque
+//
+// The owning thread pushes and pops at the bottom without any atomic
+// read-modify-write in the common case; thieves take from the top with a
+// single CAS. Only a pop racing a steal for the last element needs the CAS.
+// Memory orderings follow Le, Pop, Cohen and Zappa Nardelli, "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingDeque elements must be trivially copyable (e.g. pointers)");
+
+private:
+    // Circular buffer; replaced by a larger copy when the owner fills it
+    struct RingBuffer {
+        long long capacity;
+        long long mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit RingBuffer(long long cap)
+            : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        T get(long long i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void put(long long i, T value) { slots[i & mask].store(value, std::memory_order_relaxed); }
+
+        RingBuffer* grow(long long bottom, long long top) const {
+            RingBuffer* bigger = new RingBuffer(capacity * 2);
+            for (long long i = top; i < bottom; i++) {
+                bigger->put(i, get(i));
+            }
+            return bigger;
+        }
+    };
+
+    // top and bottom live on separate cache lines: thieves hammer top,
+    // the owner hammers bottom
+    alignas(64) std::atomic<long long> top{0};
+    alignas(64) std::atomic<long long> bottom{0};
+    alignas(64) std::atomic<RingBuffer*> buffer;
+
+    // Buffers replaced by grow() may still be read by in-flight thieves, so
+    // they are only freed with the deque (owner-only list)
+    std::vector<std::unique_ptr<RingBuffer>> retired;
+
+public:
+    explicit WorkStealingDeque(long long initial_capacity = 64) {
+        long long cap = 1;
+        while (cap < initial_capacity) cap <<= 1;
+        buffer.store(new RingBuffer(cap), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() {
+        delete buffer.load(std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only
+    void push(T value) {
+        long long b = bottom.load(std::memory_order_relaxed);
+        long long t = top.load(std::memory_order_acquire);
+        RingBuffer* a = buffer.load(std::memory_order_relaxed);
+
+        if (b - t > a->capacity - 1) {
+            RingBuffer* bigger = a->grow(b, t);
+            retired.emplace_back(a);
+            buffer.store(bigger, std::memory_order_release);
+            a = bigger;
+        }
+
+        a->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only; takes the most recently pushed element (LIFO)
+    bool pop(T& value) {
+        long long b = bottom.load(std::memory_order_relaxed) - 1;
+        RingBuffer* a = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Empty
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = a->get(b);
+        if (t == b) {
+            // Last element - race the thieves for it
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread; takes the oldest element (FIFO). Fails when empty or when
+    // it loses a race with another thief or the owner.
+    bool steal(T& value) {
+        long long t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long b = bottom.load(std::memory_order_acquire);
+
+        if (t >= b) return false;
+
+        RingBuffer* a = buffer.load(std::memory_order_acquire);
+        T candidate = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            return false;
+        }
+        value = candidate;
+        return true;
+    }
+
+    // Approximate size, safe from any thread without taking a lock
+    long long size() const {
+        long long b = bottom.load(std::memory_order_relaxed);
+        long long t = top.load(std::memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+};
+
+#endif // WORK_STEALING_DEQUE_H
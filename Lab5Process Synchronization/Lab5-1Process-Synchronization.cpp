@@ -11,45 +11,16 @@
 #include <mutex>
 #include <condition_variable>
 #include <random>
+#include <string>
+
+#include "Semaphore.h"
+#include "MPMCRing.h"
+#include "SpinLocks.h"
+#include "AdaptiveMutex.h"
 
 using namespace std;
 using namespace std::chrono;
 
-//=============================================================================
-// CUSTOM SEMAPHORE IMPLEMENTATION FOR C++17
-//=============================================================================
-
-class Semaphore {
-private:
-    mutex mtx;
-    condition_variable cv;
-    int count;
-
-public:
-    explicit Semaphore(int initial_count) : count(initial_count) {}
-
-    void acquire() {
-        unique_lock<mutex> lock(mtx);
-        cv.wait(lock, [this] { return count > 0; });
-        --count;
-    }
-
-    void release() {
-        unique_lock<mutex> lock(mtx);
-        ++count;
-        cv.notify_one();
-    }
-    
-    bool try_acquire() {
-        lock_guard<mutex> lock(mtx);
-        if (count > 0) {
-            --count;
-            return true;
-        }
-        return false;
-    }
-};
-
 //=============================================================================
 // 1. DEMONSTRATING RACE CONDITIONS (Section 6.1)
 //=============================================================================
@@ -183,6 +154,31 @@ private:
         }
     }
     
+    // The same loop around any lock with lock()/unlock()
+    template <typename Lock>
+    static void safe_increment_with(Lock& lock) {
+        for (int i = 0; i < ITERATIONS; ++i) {
+            lock.lock();
+            shared_counter++;
+            lock.unlock();
+        }
+    }
+    
+    template <typename Lock>
+    static void demonstrate_lock(const char* name) {
+        Lock lock;
+        shared_counter = 0;
+        
+        thread t1(safe_increment_with<Lock>, ref(lock));
+        thread t2(safe_increment_with<Lock>, ref(lock));
+        
+        t1.join();
+        t2.join();
+        
+        cout << name << " result: " << shared_counter << " - "
+             << (shared_counter == 2 * ITERATIONS ? "SUCCESS" : "FAILED") << endl;
+    }
+    
 public:
     static void demonstrate_test_and_set() {
         cout << "\n=== TEST AND SET DEMONSTRATION ===" << endl;
@@ -224,6 +220,18 @@ public:
         cout << "Compare-and-Swap result: " << cas_counter.load() << endl;
         cout << "Compare-and-Swap: " << (cas_counter.load() == 2 * ITERATIONS ? "SUCCESS" : "FAILED") << endl;
     }
+    
+    // Spinlocks built on the same instructions that keep waiters off the
+    // shared cache line: a ticket lock spins on a read and backs off, MCS
+    // and CLH queue the waiters so each spins on its own node
+    static void demonstrate_spinlocks() {
+        cout << "\n=== SPINLOCK FAMILY DEMONSTRATION ===" << endl;
+        cout << "Expected result: " << (2 * ITERATIONS) << endl;
+        demonstrate_lock<TTASLock>("Test-and-test-and-set lock");
+        demonstrate_lock<TicketLock>("Ticket lock");
+        demonstrate_lock<MCSLock>("MCS lock");
+        demonstrate_lock<CLHLock>("CLH lock");
+    }
 };
 
 atomic<bool> HardwareInstructions::lock_var{false};
@@ -235,7 +243,8 @@ int HardwareInstructions::shared_counter = 0;
 
 class MutexDemo {
 private:
-    static mutex mtx;
+    // Spins briefly, then sleeps; named, so its contention is profiled
+    static AdaptiveMutex mtx;
     static int shared_counter;
     static const int ITERATIONS = 100000;
     
@@ -261,10 +270,13 @@ public:
         cout << "Expected result: " << (2 * ITERATIONS) << endl;
         cout << "Mutex result: " << shared_counter << endl;
         cout << "Mutex: " << (shared_counter == 2 * ITERATIONS ? "SUCCESS" : "FAILED") << endl;
+        
+        cout << "\nLock contention profile:" << endl;
+        LockRegistry::instance().report(cout);
     }
 };
 
-mutex MutexDemo::mtx;
+AdaptiveMutex MutexDemo::mtx{"MutexDemo::mtx"};
 int MutexDemo::shared_counter = 0;
 
 //=============================================================================
@@ -316,11 +328,15 @@ Semaphore SemaphoreDemo::resource_semaphore{3}; // 3 resources available
 class ProducerConsumer {
 private:
     static const int BUFFER_SIZE = 10;
-    static int buffer[BUFFER_SIZE];
-    static int in, out, count;
-    static mutex buffer_mutex;
-    static condition_variable not_empty, not_full;
-    static bool done;
+    // Bounded buffer with per-slot sequence numbers: no buffer-wide lock,
+    // producers block while it is full and consumers while it is empty
+    static BlockingMPMCRing<int> buffer;
+    
+    // No lock is held while printing any more, so each status line goes out
+    // in a single write and lines from different threads cannot interleave
+    static void report(const string& line) {
+        cout << line + "\n" << flush;
+    }
     
 public:
     static void producer(int producer_id) {
@@ -331,18 +347,8 @@ public:
         for (int i = 0; i < 5; ++i) {
             int item = dis(gen);
             
-            unique_lock<mutex> lock(buffer_mutex);
-            not_full.wait(lock, []{ return count < BUFFER_SIZE; });
-            
-            // Critical section
-            buffer[in] = item;
-            in = (in + 1) % BUFFER_SIZE;
-            count++;
-            
-            cout << "Producer " << producer_id << " produced: " << item << endl;
-            
-            not_empty.notify_one();
-            lock.unlock();
+            buffer.push(item);  // waits for a free slot
+            report("Producer " + to_string(producer_id) + " produced: " + to_string(item));
             
             this_thread::sleep_for(milliseconds(100));
         }
@@ -350,21 +356,8 @@ public:
     
     static void consumer(int consumer_id) {
         for (int i = 0; i < 5; ++i) {
-            unique_lock<mutex> lock(buffer_mutex);
-            not_empty.wait(lock, []{ return count > 0 || done; });
-            
-            if (count > 0) {
-                // Critical section
-                int item = buffer[out];
-                out = (out + 1) % BUFFER_SIZE;
-                count--;
-                
-                cout << "Consumer " << consumer_id << " consumed: " << item << endl;
-                
-                not_full.notify_one();
-            }
-            
-            lock.unlock();
+            int item = buffer.pop();  // waits for an item
+            report("Consumer " + to_string(consumer_id) + " consumed: " + to_string(item));
             
             this_thread::sleep_for(milliseconds(150));
         }
@@ -373,12 +366,10 @@ public:
     static void demonstrate_producer_consumer() {
         cout << "\n=== PRODUCER-CONSUMER DEMONSTRATION ===" << endl;
         
-        in = out = count = 0;
-        done = false;
-        
         vector<thread> threads;
         
-        // Create 2 producers and 2 consumers
+        // Create 2 producers and 2 consumers; each consumer takes as many
+        // items as one producer makes, so nobody is left waiting
         threads.emplace_back(producer, 1);
         threads.emplace_back(producer, 2);
         threads.emplace_back(consumer, 1);
@@ -388,21 +379,11 @@ public:
             t.join();
         }
         
-        done = true;
-        not_empty.notify_all();
-        
         cout << "Producer-Consumer demonstration completed!" << endl;
     }
 };
 
-int ProducerConsumer::buffer[ProducerConsumer::BUFFER_SIZE];
-int ProducerConsumer::in = 0;
-int ProducerConsumer::out = 0;
-int ProducerConsumer::count = 0;
-mutex ProducerConsumer::buffer_mutex;
-condition_variable ProducerConsumer::not_empty;
-condition_variable ProducerConsumer::not_full;
-bool ProducerConsumer::done = false;
+BlockingMPMCRing<int> ProducerConsumer::buffer{ProducerConsumer::BUFFER_SIZE};
 
 //=============================================================================
 // 7. MONITOR IMPLEMENTATION (Section 6.7)
@@ -567,6 +548,7 @@ int main() {
         // 3. Hardware Instructions
         HardwareInstructions::demonstrate_test_and_set();
         HardwareInstructions::demonstrate_compare_and_swap();
+        HardwareInstructions::demonstrate_spinlocks();
         
         // 4. Mutex Locks
         MutexDemo::demonstrate_mutex();
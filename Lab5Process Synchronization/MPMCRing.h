@@ -0,0 +1,161 @@
+// File: MPMCRing.h
+// Bounded multi-producer multi-consumer ring buffer: lock-free try_push /
+// try_pop on per-slot sequence numbers, plus a blocking wrapper
+
+#ifndef MPMC_RING_H
+#define MPMC_RING_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#include "Semaphore.h"
+
+// Each slot carries a sequence number that says whose turn it is. For the
+// producer holding ticket pos the slot is free when sequence == pos; it
+// writes the value and publishes sequence = pos + 1, which is exactly what
+// the consumer holding ticket pos waits for. That consumer hands the slot
+// back for the next lap with sequence = pos + size. Producers and consumers
+// only contend on their own position counter (one CAS per operation) and
+// never on a shared lock. The size is rounded up to a power of two.
+template <typename T>
+class MPMCRing {
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static const size_t CACHE_LINE = 64;
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    // Kept on separate cache lines so producers and consumers do not
+    // invalidate each other's position on every operation
+    alignas(CACHE_LINE) std::atomic<size_t> enqueue_pos{0};
+    alignas(CACHE_LINE) std::atomic<size_t> dequeue_pos{0};
+
+    static size_t roundUp(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        return size;
+    }
+
+public:
+    explicit MPMCRing(size_t capacity) : slots(new Slot[roundUp(capacity)]), mask(roundUp(capacity) - 1) {
+        for (size_t i = 0; i <= mask; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MPMCRing(const MPMCRing&) = delete;
+    MPMCRing& operator=(const MPMCRing&) = delete;
+
+    size_t size() const { return mask + 1; }
+
+    // False if the ring is full; value is left untouched then
+    template <typename U>
+    bool try_push(U&& value) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[pos & mask];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::forward<U>(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // slot still holds last lap's item
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // False if the ring is empty
+    bool try_pop(T& out) {
+        size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[pos & mask];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(slot.value);
+                    slot.sequence.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // slot not written yet
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+// Exact-capacity ring whose push() and pop() block. Two counting semaphores
+// track free slots and queued items, so a full or empty ring puts threads to
+// sleep instead of spinning, and the atomic fast paths of Semaphore keep the
+// uncontended cost to a few atomic operations. A permit guarantees a slot or
+// an item, but the slot at the head of the ring may still be mid-handoff by
+// another thread for a moment; the retry loop covers that window.
+template <typename T>
+class BlockingMPMCRing {
+private:
+    MPMCRing<T> ring;
+    Semaphore free_slots;
+    Semaphore items;
+    size_t max_items;
+
+    template <typename U>
+    void place(U&& value) {
+        while (!ring.try_push(std::forward<U>(value))) std::this_thread::yield();
+        items.release();
+    }
+
+    void take(T& out) {
+        while (!ring.try_pop(out)) std::this_thread::yield();
+        free_slots.release();
+    }
+
+public:
+    explicit BlockingMPMCRing(size_t capacity)
+        : ring(capacity), free_slots(static_cast<int>(capacity)), items(0), max_items(capacity) {}
+
+    size_t capacity() const { return max_items; }
+
+    // Waits while the ring is full
+    template <typename U>
+    void push(U&& value) {
+        free_slots.acquire();
+        place(std::forward<U>(value));
+    }
+
+    // Waits while the ring is empty
+    T pop() {
+        items.acquire();
+        T out;
+        take(out);
+        return out;
+    }
+
+    template <typename U>
+    bool try_push(U&& value) {
+        if (!free_slots.try_acquire()) return false;
+        place(std::forward<U>(value));
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        if (!items.try_acquire()) return false;
+        take(out);
+        return true;
+    }
+};
+
+#endif // MPMC_RING_H
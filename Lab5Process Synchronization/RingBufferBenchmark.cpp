@@ -0,0 +1,279 @@
+// File: ring_buffer_benchmark.cpp
+// Compile: g++ -O2 -o ring_buffer_benchmark ring_buffer_benchmark.cpp -std=c++17 -pthread
+//
+// Usage:
+//   ring_buffer_benchmark [items] [capacity] [max_threads_per_side]
+//
+// Throughput and latency of a bounded producer/consumer buffer, comparing
+// the mutex + two condition variables design of ProducerConsumer with the
+// MPMC ring, used blocking (push/pop) and non-blocking (try_push/try_pop
+// retried with a yield). Every configuration moves the same number of items
+// (default 1000000) through a buffer of the same capacity (default 1024)
+// with P producers and P consumers, P = 1, 2, 4 ... max_threads_per_side
+// (default 8). Each item carries its enqueue time, so the consumer side
+// measures how long items sat in the buffer.
+//
+// A second table covers a single producer/consumer pair, where the SPSC
+// ring applies: items are plain sequence numbers (checked for order on the
+// consumer side) so the cost per item is not hidden behind clock reads, and
+// the SPSC ring is also driven with push_n / pop_n batches.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <string>
+#include <cstdlib>
+
+#include "MPMCRing.h"
+#include "SPSCRing.h"
+
+using Clock = std::chrono::steady_clock;
+
+static long long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// The ProducerConsumer design: one lock around the whole array
+class LockedQueue {
+private:
+    std::vector<long long> buffer;
+    size_t in = 0, out = 0, count = 0;
+    std::mutex buffer_mutex;
+    std::condition_variable not_empty, not_full;
+
+public:
+    explicit LockedQueue(size_t capacity) : buffer(capacity) {}
+
+    void push(long long item) {
+        std::unique_lock<std::mutex> lock(buffer_mutex);
+        not_full.wait(lock, [this] { return count < buffer.size(); });
+        buffer[in] = item;
+        in = (in + 1) % buffer.size();
+        count++;
+        not_empty.notify_one();
+    }
+
+    long long pop() {
+        std::unique_lock<std::mutex> lock(buffer_mutex);
+        not_empty.wait(lock, [this] { return count > 0; });
+        long long item = buffer[out];
+        out = (out + 1) % buffer.size();
+        count--;
+        not_full.notify_one();
+        return item;
+    }
+};
+
+class BlockingRingQueue {
+private:
+    BlockingMPMCRing<long long> ring;
+
+public:
+    explicit BlockingRingQueue(size_t capacity) : ring(capacity) {}
+    void push(long long item) { ring.push(item); }
+    long long pop() { return ring.pop(); }
+};
+
+class SpinningRingQueue {
+private:
+    MPMCRing<long long> ring;
+
+public:
+    explicit SpinningRingQueue(size_t capacity) : ring(capacity) {}
+    void push(long long item) {
+        while (!ring.try_push(item)) std::this_thread::yield();
+    }
+    long long pop() {
+        long long item;
+        while (!ring.try_pop(item)) std::this_thread::yield();
+        return item;
+    }
+};
+
+class SpscQueue {
+private:
+    SPSCRing<long long> ring;
+
+public:
+    explicit SpscQueue(size_t capacity) : ring(capacity) {}
+    void push(long long item) {
+        while (!ring.try_push(item)) std::this_thread::yield();
+    }
+    long long pop() {
+        long long item;
+        while (!ring.try_pop(item)) std::this_thread::yield();
+        return item;
+    }
+};
+
+struct RunResult {
+    double items_per_sec;
+    double p50_us;
+    double p99_us;
+    double max_us;
+};
+
+template <typename Queue>
+RunResult run(long long items, size_t capacity, int pairs) {
+    Queue queue(capacity);
+    std::vector<std::vector<long long>> latencies(pairs);
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+
+    // Item i goes to producer / consumer i % pairs, so every side has work
+    auto share = [&](int id) { return items / pairs + (id < items % pairs ? 1 : 0); };
+
+    for (int id = 0; id < pairs; id++) {
+        threads.emplace_back([&, id]() {
+            long long n = share(id);
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (long long i = 0; i < n; i++) queue.push(nowNs());
+        });
+        threads.emplace_back([&, id]() {
+            long long n = share(id);
+            std::vector<long long>& waits = latencies[id];
+            waits.reserve(n);
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (long long i = 0; i < n; i++) {
+                long long sent = queue.pop();
+                waits.push_back(nowNs() - sent);
+            }
+        });
+    }
+
+    auto begin = Clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    std::vector<long long> all;
+    all.reserve(items);
+    for (const auto& waits : latencies) all.insert(all.end(), waits.begin(), waits.end());
+    auto percentile = [&all](double q) {
+        size_t k = std::min(all.size() - 1, static_cast<size_t>(q * all.size()));
+        std::nth_element(all.begin(), all.begin() + k, all.end());
+        return all[k] / 1000.0;
+    };
+
+    RunResult result;
+    result.items_per_sec = seconds > 0 ? items / seconds : 0.0;
+    result.p50_us = percentile(0.50);
+    result.p99_us = percentile(0.99);
+    result.max_us = *std::max_element(all.begin(), all.end()) / 1000.0;
+    return result;
+}
+
+// One producer, one consumer, items 0..items-1; returns items per second or
+// a negative value if the consumer saw them out of order
+template <typename Queue>
+double runPair(long long items, size_t capacity) {
+    Queue queue(capacity);
+    bool in_order = true;
+    auto begin = Clock::now();
+    std::thread producer([&]() {
+        for (long long i = 0; i < items; i++) queue.push(i);
+    });
+    for (long long i = 0; i < items; i++) {
+        if (queue.pop() != i) in_order = false;
+    }
+    producer.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return in_order ? items / seconds : -1.0;
+}
+
+// Same pair through the SPSC ring, batch items per push_n / pop_n call
+static double runBatched(long long items, size_t capacity, size_t batch) {
+    SPSCRing<long long> ring(capacity);
+    bool in_order = true;
+    auto begin = Clock::now();
+    std::thread producer([&]() {
+        std::vector<long long> chunk(batch);
+        for (long long next = 0; next < items;) {
+            size_t n = static_cast<size_t>(std::min<long long>(batch, items - next));
+            for (size_t k = 0; k < n; k++) chunk[k] = next + k;
+            for (size_t sent = 0; sent < n;) {
+                size_t pushed = ring.push_n(chunk.data() + sent, n - sent);
+                if (pushed == 0) std::this_thread::yield();
+                sent += pushed;
+            }
+            next += n;
+        }
+    });
+    std::vector<long long> chunk(batch);
+    for (long long expected = 0; expected < items;) {
+        size_t got = ring.pop_n(chunk.data(), batch);
+        if (got == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t k = 0; k < got; k++) {
+            if (chunk[k] != expected + static_cast<long long>(k)) in_order = false;
+        }
+        expected += got;
+    }
+    producer.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return in_order ? items / seconds : -1.0;
+}
+
+static void printPairRow(const std::string& design, double items_per_sec) {
+    std::cout << std::left << std::setw(30) << design << std::right << std::fixed;
+    if (items_per_sec < 0) {
+        std::cout << std::setw(14) << "OUT OF ORDER" << "\n";
+        return;
+    }
+    std::cout << std::setprecision(0) << std::setw(14) << items_per_sec
+              << std::setprecision(2) << std::setw(12) << 1e9 / items_per_sec << "\n";
+}
+
+static void printRow(const std::string& config, const std::string& design, const RunResult& r) {
+    std::cout << std::left << std::setw(8) << config << std::setw(22) << design
+              << std::right << std::fixed
+              << std::setprecision(0) << std::setw(14) << r.items_per_sec
+              << std::setprecision(2) << std::setw(12) << r.p50_us
+              << std::setw(12) << r.p99_us
+              << std::setw(12) << r.max_us << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    long long items = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    long long capacity = argc > 2 ? std::atoll(argv[2]) : 1024;
+    int max_pairs = argc > 3 ? std::atoi(argv[3]) : 8;
+    if (items < 1 || capacity < 1 || max_pairs < 1) {
+        std::cerr << "Usage: " << argv[0] << " [items] [capacity] [max_threads_per_side]\n";
+        return 1;
+    }
+
+    std::cout << "=== BOUNDED BUFFER BENCHMARK ===\n";
+    std::cout << items << " items, capacity " << capacity << ", "
+              << std::thread::hardware_concurrency() << " hardware threads\n\n";
+    std::cout << std::left << std::setw(8) << "PxC" << std::setw(22) << "Design"
+              << std::right << std::setw(14) << "items/s"
+              << std::setw(12) << "p50 us" << std::setw(12) << "p99 us" << std::setw(12) << "max us" << "\n";
+
+    for (int pairs = 1; pairs <= max_pairs; pairs *= 2) {
+        std::string config = std::to_string(pairs) + "x" + std::to_string(pairs);
+        printRow(config, "mutex+cv", run<LockedQueue>(items, capacity, pairs));
+        printRow(config, "mpmc ring (blocking)", run<BlockingRingQueue>(items, capacity, pairs));
+        printRow(config, "mpmc ring (try+yield)", run<SpinningRingQueue>(items, capacity, pairs));
+    }
+
+    std::cout << "\n=== SINGLE PRODUCER / SINGLE CONSUMER ===\n";
+    std::cout << std::left << std::setw(30) << "Design"
+              << std::right << std::setw(14) << "items/s" << std::setw(12) << "ns/item" << "\n";
+    printPairRow("mutex+cv", runPair<LockedQueue>(items, capacity));
+    printPairRow("mpmc ring (try+yield)", runPair<SpinningRingQueue>(items, capacity));
+    printPairRow("spsc ring (try+yield)", runPair<SpscQueue>(items, capacity));
+    for (size_t batch : {16, 64, 256}) {
+        if (batch > static_cast<size_t>(capacity)) break;
+        printPairRow("spsc ring (push_n/pop_n " + std::to_string(batch) + ")",
+                     runBatched(items, capacity, batch));
+    }
+    return 0;
+}
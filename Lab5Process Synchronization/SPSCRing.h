@@ -0,0 +1,127 @@
+// File: SPSCRing.h
+// Bounded single-producer single-consumer ring buffer with cached indices
+// and bulk push_n / pop_n
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+// tail is written only by the producer and head only by the consumer, so
+// each operation is a plain store of its own index with release ordering;
+// no CAS and no lock. Both indices run freely and are masked into a
+// power-of-two slot array, which lets the capacity stay exact. Each side
+// keeps a private copy of the other side's index and rereads the shared
+// one only when the copy says the ring is full (producer) or empty
+// (consumer), so in steady state neither side touches the other's cache
+// line. push_n / pop_n move a whole span for one index update, which
+// spreads that single synchronization over every item in the batch.
+template <typename T>
+class SPSCRing {
+private:
+    static const size_t CACHE_LINE = 64;
+
+    std::unique_ptr<T[]> slots;
+    size_t mask;
+    size_t max_items;
+
+    // Consumer side
+    alignas(CACHE_LINE) std::atomic<size_t> head{0};
+    size_t cached_tail = 0;
+    // Producer side
+    alignas(CACHE_LINE) std::atomic<size_t> tail{0};
+    size_t cached_head = 0;
+
+    static size_t roundUp(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        return size;
+    }
+
+    // Free slots as seen by the producer; rereads head only when needed
+    size_t freeSlots(size_t t, size_t wanted) {
+        size_t free = max_items - (t - cached_head);
+        if (free < wanted) {
+            cached_head = head.load(std::memory_order_acquire);
+            free = max_items - (t - cached_head);
+        }
+        return free;
+    }
+
+    // Queued items as seen by the consumer; rereads tail only when needed
+    size_t queuedItems(size_t h, size_t wanted) {
+        size_t queued = cached_tail - h;
+        if (queued < wanted) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            queued = cached_tail - h;
+        }
+        return queued;
+    }
+
+public:
+    explicit SPSCRing(size_t capacity)
+        : slots(new T[roundUp(std::max<size_t>(capacity, 1))]),
+          mask(roundUp(std::max<size_t>(capacity, 1)) - 1),
+          max_items(std::max<size_t>(capacity, 1)) {}
+
+    SPSCRing(const SPSCRing&) = delete;
+    SPSCRing& operator=(const SPSCRing&) = delete;
+
+    size_t capacity() const { return max_items; }
+
+    // ---- Producer thread only ----
+
+    // False if the ring is full; value is left untouched then
+    template <typename U>
+    bool try_push(U&& value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (freeSlots(t, 1) == 0) return false;
+        slots[t & mask] = std::forward<U>(value);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Copies up to n items in order; returns how many fit
+    size_t push_n(const T* items, size_t n) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t count = std::min(n, freeSlots(t, n));
+        if (count == 0) return 0;
+        // The span may wrap past the end of the slot array
+        size_t start = t & mask;
+        size_t first = std::min(count, mask + 1 - start);
+        std::copy(items, items + first, slots.get() + start);
+        std::copy(items + first, items + count, slots.get());
+        tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    // ---- Consumer thread only ----
+
+    // False if the ring is empty
+    bool try_pop(T& out) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (queuedItems(h, 1) == 0) return false;
+        out = std::move(slots[h & mask]);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Moves up to n items in order into out; returns how many there were
+    size_t pop_n(T* out, size_t n) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t count = std::min(n, queuedItems(h, n));
+        if (count == 0) return 0;
+        size_t start = h & mask;
+        size_t first = std::min(count, mask + 1 - start);
+        std::move(slots.get() + start, slots.get() + start + first, out);
+        std::move(slots.get(), slots.get() + (count - first), out + first);
+        head.store(h + count, std::memory_order_release);
+        return count;
+    }
+};
+
+#endif // SPSC_RING_H
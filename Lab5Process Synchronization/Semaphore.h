@@ -0,0 +1,134 @@
+// File: Semaphore.h
+// Counting semaphore with an atomic fast path that parks waiters on a futex
+// only under contention (shared by the Chapter 6 and dining philosopher labs)
+
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include <atomic>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#include "SpinLocks.h"
+
+// count holds the free permits and is also the futex word; waiters counts
+// threads that may be asleep on it. An uncontended acquire() is one CAS on
+// count and an uncontended release() one fetch_add.
+// A woken thread competes for the permit again rather than being handed it,
+// so a running thread can take a freshly released permit without waiting
+// for the sleeper to be scheduled (the same barging a mutex allows).
+// At most one wakeup is in flight: waking is set by the thread that issued
+// it and cleared by the thread it woke, so releases that come before the
+// woken thread gets a CPU skip the system call.
+class Semaphore {
+private:
+    std::atomic<int> count;
+    std::atomic<int> waiters{0};
+    std::atomic<bool> waking{false};
+
+    static const int SPIN_LIMIT = 100;
+    static const int YIELD_LIMIT = 4;
+
+#ifdef __linux__
+    // Sleep while count is still 0; returns at once if it already changed
+    void park() {
+        syscall(SYS_futex, reinterpret_cast<int*>(&count), FUTEX_WAIT_PRIVATE, 0, nullptr, nullptr, 0);
+    }
+    // True if a sleeping thread was woken
+    bool unpark() {
+        return syscall(SYS_futex, reinterpret_cast<int*>(&count), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0) > 0;
+    }
+#else
+    std::mutex park_mtx;
+    std::condition_variable park_cv;
+    int sleepers = 0;
+
+    void park() {
+        std::unique_lock<std::mutex> lock(park_mtx);
+        if (count.load() != 0) return;
+        sleepers++;
+        park_cv.wait(lock);
+        sleepers--;
+    }
+    bool unpark() {
+        std::lock_guard<std::mutex> lock(park_mtx);
+        if (sleepers == 0) return false;
+        park_cv.notify_one();
+        return true;
+    }
+#endif
+
+    // Wake one sleeper for the free permits unless a wakeup is already in
+    // flight. If nobody was asleep yet, the flag is dropped and the check
+    // repeated: while the flag was up, another release may have skipped its
+    // own wakeup, and the waiter it left behind has gone to sleep since.
+    void signal() {
+        while (count.load() > 0 && waiters.load() > 0) {
+            if (waking.exchange(true)) return;
+            if (unpark()) return;
+            waking.store(false);
+            std::this_thread::yield();
+        }
+    }
+
+public:
+    explicit Semaphore(int initial_count) : count(initial_count) {}
+
+    Semaphore(const Semaphore&) = delete;
+    Semaphore& operator=(const Semaphore&) = delete;
+
+    void acquire() {
+        if (try_acquire()) return;
+
+        // The holder is often about to release: spin briefly, then give it
+        // the CPU a few times before sleeping
+        for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+            if (try_acquire()) return;
+            cpuRelax();
+        }
+        for (int yield = 0; yield < YIELD_LIMIT; ++yield) {
+            std::this_thread::yield();
+            if (try_acquire()) return;
+        }
+
+        // Registering in waiters before the last check of count pairs with
+        // release() bumping count before it reads waiters, so either this
+        // thread sees the permit or the releaser sees this thread
+        waiters.fetch_add(1);
+        while (!try_acquire()) {
+            park();
+            waking.store(false);
+        }
+        waiters.fetch_sub(1);
+
+        // Permits released while the wakeup was in flight go to the next sleeper
+        signal();
+    }
+
+    // Only the 0 -> 1 step needs a wakeup: while count stays positive the
+    // woken thread is on its way and passes the rest on when it gets its permit
+    void release() {
+        if (count.fetch_add(1) == 0) signal();
+    }
+
+    bool try_acquire() {
+        int permits = count.load(std::memory_order_relaxed);
+        while (permits > 0) {
+            if (count.compare_exchange_weak(permits, permits - 1, std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+#endif // SEMAPHORE_H
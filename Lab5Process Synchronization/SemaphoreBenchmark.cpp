@@ -0,0 +1,110 @@
+// File: semaphore_benchmark.cpp
+// Compile: g++ -O2 -o semaphore_benchmark semaphore_benchmark.cpp -std=c++17 -pthread
+//
+// Usage:
+//   semaphore_benchmark [permits] [ms_per_run] [max_threads]
+//
+// Throughput of acquire()/release() pairs for the futex-backed Semaphore
+// against the mutex + condition_variable semaphore it replaced. Every thread
+// loops acquire/release on one shared semaphore for a fixed time, at 1, 2, 4
+// ... max_threads threads (default 64). With threads <= permits the futex
+// version never leaves its atomic fast path; above that, waiters park.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <cstdlib>
+
+#include "Semaphore.h"
+
+// The previous implementation: a lock round trip on every operation
+class MutexSemaphore {
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    int count;
+
+public:
+    explicit MutexSemaphore(int initial_count) : count(initial_count) {}
+
+    void acquire() {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this] { return count > 0; });
+        --count;
+    }
+
+    void release() {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++count;
+        cv.notify_one();
+    }
+};
+
+// acquire/release pairs per second over all threads
+template <typename Sem>
+double measure(int threads, int permits, int run_ms) {
+    Sem sem(permits);
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<long long> ops(threads, 0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            long long done = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                sem.acquire();
+                sem.release();
+                done++;
+            }
+            ops[t] = done;
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(run_ms));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& w : workers) w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    long long total = 0;
+    for (long long n : ops) total += n;
+    return total / seconds;
+}
+
+int main(int argc, char* argv[]) {
+    int permits = argc > 1 ? std::atoi(argv[1]) : 4;
+    int run_ms = argc > 2 ? std::atoi(argv[2]) : 200;
+    int max_threads = argc > 3 ? std::atoi(argv[3]) : 64;
+    if (permits < 1 || run_ms < 1 || max_threads < 1) {
+        std::cerr << "Usage: " << argv[0] << " [permits] [ms_per_run] [max_threads]\n";
+        return 1;
+    }
+
+    std::cout << "=== SEMAPHORE CONTENTION BENCHMARK ===\n";
+    std::cout << "Permits: " << permits << ", " << run_ms << " ms per run, "
+              << std::thread::hardware_concurrency() << " hardware threads\n\n";
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::right << std::setw(18) << "mutex+cv ops/s"
+              << std::setw(18) << "futex ops/s"
+              << std::setw(10) << "Speedup" << "\n";
+    std::cout << std::fixed << std::setprecision(0);
+
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double baseline = measure<MutexSemaphore>(threads, permits, run_ms);
+        double futex = measure<Semaphore>(threads, permits, run_ms);
+        std::cout << std::left << std::setw(10) << threads
+                  << std::right << std::setw(18) << baseline
+                  << std::setw(18) << futex
+                  << std::setw(9) << std::setprecision(2) << (baseline > 0 ? futex / baseline : 0.0) << "x\n"
+                  << std::setprecision(0);
+    }
+    return 0;
+}
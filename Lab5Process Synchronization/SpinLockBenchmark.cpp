@@ -0,0 +1,161 @@
+// File: spinlock_benchmark.cpp
+// Compile: g++ -O2 -o spinlock_benchmark spinlock_benchmark.cpp -std=c++17 -pthread
+//
+// Usage:
+//   spinlock_benchmark [max_threads] [ms_per_run] [--pin]
+//
+// Scaling of the SpinLocks.h family against std::mutex at 1, 2, 4 ...
+// max_threads threads (default: hardware threads). Each thread loops on a
+// tiny critical section that bumps a shared counter for a fixed time. For
+// every lock the table shows acquisitions per second, the average time per
+// acquisition, and how often the lock (and the counter's cache line) moved
+// to a different thread than the previous holder - the handoffs that cost
+// a cache-line transfer, and a cross-socket one when the two threads sit on
+// different sockets. --pin places thread i on CPU i (Linux), filling the
+// CPUs in the order the kernel numbers them; on most 2-socket machines that
+// keeps small runs on one socket. Compare with taskset / numactl to force a
+// placement. Past one thread per CPU the FIFO locks (ticket, MCS, CLH)
+// fall off a cliff: the next owner in line is often descheduled, and every
+// handoff waits for it to run again.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "SpinLocks.h"
+
+struct RunResult {
+    double ops_per_sec;
+    double ns_per_op;
+    double handoff_percent;
+    bool consistent;
+};
+
+// Data guarded by the lock; the owner id makes each acquisition record
+// whether the line had to come from another thread
+struct alignas(SPIN_CACHE_LINE) Shared {
+    long long counter = 0;
+    long long handoffs = 0;
+    int last_owner = -1;
+};
+
+static void pinToCpu(int index) {
+#ifdef __linux__
+    unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(index % cpus, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)index;
+#endif
+}
+
+template <typename Lock>
+RunResult measure(int threads, int run_ms, bool pin) {
+    Lock lock;
+    Shared shared;
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<long long> ops(threads, 0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            if (pin) pinToCpu(t);
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            long long done = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                lock.lock();
+                shared.counter++;
+                if (shared.last_owner != t) {
+                    shared.handoffs++;
+                    shared.last_owner = t;
+                }
+                lock.unlock();
+                done++;
+            }
+            ops[t] = done;
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(run_ms));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& w : workers) w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    long long total = 0;
+    for (long long n : ops) total += n;
+    RunResult result;
+    result.ops_per_sec = total / seconds;
+    result.ns_per_op = total > 0 ? seconds * 1e9 / total : 0.0;
+    result.handoff_percent = total > 0 ? 100.0 * shared.handoffs / total : 0.0;
+    result.consistent = shared.counter == total;
+    return result;
+}
+
+template <typename Lock>
+void report(const char* name, int threads, int run_ms, bool pin) {
+    RunResult r = measure<Lock>(threads, run_ms, pin);
+    std::cout << std::left << std::setw(10) << threads << std::setw(12) << name
+              << std::right << std::fixed << std::setprecision(0) << std::setw(14) << r.ops_per_sec
+              << std::setprecision(1) << std::setw(10) << r.ns_per_op
+              << std::setw(11) << r.handoff_percent << "%"
+              << (r.consistent ? "" : "  COUNTER MISMATCH") << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    int max_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int run_ms = 200;
+    bool pin = false;
+    int positional = 0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--pin") == 0) {
+            pin = true;
+        } else if (positional == 0) {
+            max_threads = std::atoi(argv[i]);
+            positional++;
+        } else if (positional == 1) {
+            run_ms = std::atoi(argv[i]);
+            positional++;
+        } else {
+            max_threads = 0;
+        }
+    }
+    if (max_threads < 1 || run_ms < 1) {
+        std::cerr << "Usage: " << argv[0] << " [max_threads] [ms_per_run] [--pin]\n";
+        return 1;
+    }
+
+    std::cout << "=== SPINLOCK SCALING BENCHMARK ===\n";
+    std::cout << std::thread::hardware_concurrency() << " hardware threads, " << run_ms
+              << " ms per run" << (pin ? ", threads pinned" : "") << "\n\n";
+    std::cout << std::left << std::setw(10) << "Threads" << std::setw(12) << "Lock"
+              << std::right << std::setw(14) << "acquires/s" << std::setw(10) << "ns/op"
+              << std::setw(12) << "handoffs" << "\n";
+
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        report<TASLock>("tas", threads, run_ms, pin);
+        report<TTASLock>("ttas", threads, run_ms, pin);
+        report<TicketLock>("ticket", threads, run_ms, pin);
+        report<MCSLock>("mcs", threads, run_ms, pin);
+        report<CLHLock>("clh", threads, run_ms, pin);
+        report<std::mutex>("std::mutex", threads, run_ms, pin);
+        std::cout << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+// File: SpinLocks.h
+// Test-and-set, ticket, MCS and CLH spinlocks with exponential backoff,
+// all with lock()/unlock() so they work with std::lock_guard
+
+#ifndef SPIN_LOCKS_H
+#define SPIN_LOCKS_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstddef>
+
+static const size_t SPIN_CACHE_LINE = 64;
+
+// One iteration of a busy-wait loop: tells the core we are spinning so it
+// can yield pipeline resources to a sibling hyperthread
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// Exponential backoff: each failed attempt doubles the pause up to a cap;
+// past the cap the thread yields, so a waiter whose lock holder has been
+// preempted gives the CPU back instead of burning its whole time slice
+class Backoff {
+private:
+    static const int MIN_SPINS = 4;
+    static const int MAX_SPINS = 1024;
+    int spins = MIN_SPINS;
+
+public:
+    void pause() {
+        if (spins > MAX_SPINS) {
+            std::this_thread::yield();
+            return;
+        }
+        for (int i = 0; i < spins; ++i) cpuRelax();
+        spins <<= 1;
+    }
+};
+
+// The HardwareInstructions lock: every waiter keeps writing the same flag,
+// so each attempt drags its cache line over to the spinning core
+class TASLock {
+private:
+    std::atomic<bool> flag{false};
+
+public:
+    void lock() {
+        while (flag.exchange(true, std::memory_order_acquire)) {
+        }
+    }
+    void unlock() { flag.store(false, std::memory_order_release); }
+};
+
+// Test-and-test-and-set: spin on a read (served from the local cache)
+// and only try the exchange when the lock looks free, backing off after
+// every lost race
+class TTASLock {
+private:
+    std::atomic<bool> flag{false};
+
+public:
+    void lock() {
+        Backoff backoff;
+        for (;;) {
+            while (flag.load(std::memory_order_relaxed)) backoff.pause();
+            if (!flag.exchange(true, std::memory_order_acquire)) return;
+            backoff.pause();
+        }
+    }
+    void unlock() { flag.store(false, std::memory_order_release); }
+};
+
+// FIFO by ticket number. Waiters only read now_serving, and back off in
+// proportion to how many tickets are ahead of them, so the line is not
+// re-read by everybody on every handoff. Still one shared line: each
+// release invalidates it in every waiter's cache.
+class TicketLock {
+private:
+    static const int SPINS_PER_TICKET = 64;
+
+    alignas(SPIN_CACHE_LINE) std::atomic<unsigned> next_ticket{0};
+    alignas(SPIN_CACHE_LINE) std::atomic<unsigned> now_serving{0};
+
+public:
+    void lock() {
+        unsigned ticket = next_ticket.fetch_add(1, std::memory_order_relaxed);
+        Backoff backoff;
+        for (;;) {
+            unsigned serving = now_serving.load(std::memory_order_acquire);
+            if (serving == ticket) return;
+            unsigned ahead = ticket - serving;
+            if (ahead > 1) {
+                for (unsigned i = 0; i < (ahead - 1) * SPINS_PER_TICKET; ++i) cpuRelax();
+            } else {
+                backoff.pause();
+            }
+        }
+    }
+    void unlock() {
+        now_serving.store(now_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+};
+
+// Queue locks hand out one node per acquisition and each waiter spins on a
+// flag in a node of its own, so a release touches exactly one other cache
+// line. Nodes come from a per-thread spare, so lock()/unlock() need no
+// caller-supplied node; the holder keeps its node pointer in the lock,
+// which only the holder reads.
+
+// MCS: a waiter links its node behind the tail and spins on its own flag;
+// the holder passes the lock by clearing its successor's flag
+class MCSLock {
+private:
+    struct alignas(SPIN_CACHE_LINE) Node {
+        std::atomic<Node*> next{nullptr};
+        std::atomic<bool> locked{false};
+    };
+
+    static Node* takeNode() {
+        Node* node = spare().release();
+        return node ? node : new Node;
+    }
+    static void returnNode(Node* node) {
+        if (spare()) delete node;
+        else spare().reset(node);
+    }
+    static std::unique_ptr<Node>& spare() {
+        static thread_local std::unique_ptr<Node> node;
+        return node;
+    }
+
+    alignas(SPIN_CACHE_LINE) std::atomic<Node*> tail{nullptr};
+    Node* holder = nullptr;
+
+public:
+    void lock() {
+        Node* node = takeNode();
+        node->next.store(nullptr, std::memory_order_relaxed);
+        node->locked.store(true, std::memory_order_relaxed);
+        Node* pred = tail.exchange(node, std::memory_order_acq_rel);
+        if (pred) {
+            pred->next.store(node, std::memory_order_release);
+            Backoff backoff;
+            while (node->locked.load(std::memory_order_acquire)) backoff.pause();
+        }
+        holder = node;
+    }
+
+    void unlock() {
+        Node* node = holder;
+        Node* succ = node->next.load(std::memory_order_acquire);
+        if (!succ) {
+            Node* expected = node;
+            if (tail.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+                returnNode(node);
+                return;
+            }
+            // A waiter swapped itself in but has not linked up yet
+            Backoff backoff;
+            while (!(succ = node->next.load(std::memory_order_acquire))) backoff.pause();
+        }
+        succ->locked.store(false, std::memory_order_release);
+        returnNode(node);
+    }
+};
+
+// CLH: an implicit queue - a waiter swaps its node into the tail and spins
+// on its predecessor's node. On release the holder clears its own node and
+// keeps the predecessor's, which nobody references any more.
+class CLHLock {
+private:
+    struct alignas(SPIN_CACHE_LINE) Node {
+        std::atomic<bool> locked{false};
+    };
+
+    static Node* takeNode() {
+        Node* node = spare().release();
+        return node ? node : new Node;
+    }
+    static void returnNode(Node* node) {
+        if (spare()) delete node;
+        else spare().reset(node);
+    }
+    static std::unique_ptr<Node>& spare() {
+        static thread_local std::unique_ptr<Node> node;
+        return node;
+    }
+
+    alignas(SPIN_CACHE_LINE) std::atomic<Node*> tail;
+    Node* holder = nullptr;
+    Node* holder_pred = nullptr;
+
+public:
+    CLHLock() : tail(new Node) {}
+    ~CLHLock() { delete tail.load(); }
+
+    CLHLock(const CLHLock&) = delete;
+    CLHLock& operator=(const CLHLock&) = delete;
+
+    void lock() {
+        Node* node = takeNode();
+        node->locked.store(true, std::memory_order_relaxed);
+        Node* pred = tail.exchange(node, std::memory_order_acq_rel);
+        Backoff backoff;
+        while (pred->locked.load(std::memory_order_acquire)) backoff.pause();
+        holder = node;
+        holder_pred = pred;
+    }
+
+    void unlock() {
+        Node* pred = holder_pred;
+        holder->locked.store(false, std::memory_order_release);
+        returnNode(pred);
+    }
+};
+
+#endif // SPIN_LOCKS_H